@@ -0,0 +1,387 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "analyze.h"
+#include "bench.h"
+#include "searchworker.h"
+#include "cmdargs.h"
+#include "movegen.h"
+#include "timer.h"
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+namespace {
+
+struct EpdPosition {
+    std::string fen;
+    std::string id;
+    std::string bestMoves;  // "bm" opcode, SAN moves
+    std::string avoidMoves; // "am" opcode, SAN moves
+};
+
+// Returns value of the EPD opcode (without quotes and ';'), empty if there is none
+std::string epdOpcode(const std::string &line, const std::string &opcode){
+    size_t start = line.find(" " + opcode + " ");
+    if (start == std::string::npos) return "";
+    start += opcode.size() + 2;
+
+    size_t end = line.find(';', start);
+    std::string value = line.substr(start, end == std::string::npos ? std::string::npos : end - start);
+    value.erase(0, value.find_first_not_of(" \""));
+    value.erase(value.find_last_not_of(" \"") + 1);
+    return value;
+}
+
+std::vector<EpdPosition> loadEpd(const std::string &path){
+    std::ifstream file(path);
+    if (!file){
+        fatal("Failed to open position file " + path);
+    }
+
+    std::vector<EpdPosition> positions;
+    std::string line;
+    while (std::getline(file, line)){
+        if (line.find_first_not_of(" \t\r") == std::string::npos || line[0] == '#') continue;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        EpdPosition pos;
+        pos.fen = normalizeFen(line);
+        pos.id  = epdOpcode(line, "id");
+        pos.bestMoves  = epdOpcode(line, "bm");
+        pos.avoidMoves = epdOpcode(line, "am");
+        positions.push_back(pos);
+    }
+    return positions;
+}
+
+std::string jsonEscape(const std::string &s){
+    std::string out;
+    for (char c : s){
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+// Converts space separated SAN moves to moves of the position,
+// returns false if one of them is not a legal move of the position
+bool parseMoves(const Board &board, const std::string &moves, std::vector<Move> &parsed){
+    std::istringstream is(moves);
+    std::string san;
+    while (is >> san){
+        Move move = Move::fromSan(board, san);
+        if (move.getFlags() & Move::NULL_MOVE) return false;
+        parsed.push_back(move);
+    }
+    return true;
+}
+
+bool containsMove(const std::vector<Move> &moves, Move move){
+    for (auto &m : moves){
+        if (m.getFrom() == move.getFrom() && m.getTo() == move.getTo() &&
+            (m.getFlags() & Move::PROMOTION) == (move.getFlags() & Move::PROMOTION) &&
+            (!(m.getFlags() & Move::PROMOTION) || m.getPromotionPieceType() == move.getPromotionPieceType())){
+            return true;
+        }
+    }
+    return false;
+}
+
+bool hasLegalMoves(const Board &board){
+    MoveList moves;
+    MoveGen(&board, false, &moves);
+
+    for (auto &move : moves){
+        Board movedBoard = board;
+        if (movedBoard.doMove(move)) return true;
+    }
+    return false;
+}
+
+// Value below which the given share of the sorted values lies
+template <typename T>
+T percentile(const std::vector<T> &sorted, int percent){
+    if (sorted.empty()) return T();
+    return sorted[std::max((size_t) 1, (sorted.size() * percent + 99) / 100) - 1];
+}
+
+// UCI-like score: {"cp": x} or {"mate": n}
+std::string jsonScore(int score){
+    if (abs(score) >= WON_IN_X){
+        int dist = (-LOST_SCORE - abs(score) + 1) / 2;
+        return "{\"mate\": " + std::to_string(score > 0 ? dist : -dist) + "}";
+    }
+    return "{\"cp\": " + std::to_string(score) + "}";
+}
+
+}
+
+void analyze(int argCount, char* argValue[]){
+    if (argCount < 3){
+        std::cout << "Usage: analyze <file> [threads] [hash] [depth N] [nodes N] [movetime N] [output FILE]" << std::endl;
+        return;
+    }
+
+    // positional: threads, hash; keywords with values anywhere
+    CmdArgs args(argCount, argValue, 3, {"depth", "nodes", "movetime", "output"});
+    int threads  = args.positionalInt(0, 1);
+    int hashSize = args.positionalInt(1, 16);
+    std::string outPath = args.get("output", "");
+    Limits limits;
+    limits.depth    = args.getInt("depth", 0);
+    limits.nodes    = args.getU64("nodes", 0);
+    limits.moveTime = args.getInt("movetime", 0);
+
+    threads  = std::max(MIN_THREADS, std::min(threads, MAX_THREADS));
+    hashSize = std::max(MIN_HASH, std::min(hashSize, MAX_HASH));
+    limits.depth = std::max(0, std::min(limits.depth, MAX_SEARCH_DEPTH));
+    if (!limits.depth && !limits.nodes && !limits.moveTime){
+        limits.depth = ANALYZE_SEARCH_DEPTH;
+    }
+
+    std::vector<EpdPosition> positions = loadEpd(argValue[2]);
+
+    std::ofstream outFile;
+    if (!outPath.empty()){
+        outFile.open(outPath);
+        if (!outFile){
+            fatal("Failed to open " + outPath);
+        }
+    }
+    std::ostream &out = outPath.empty() ? std::cout : outFile;
+
+    std::mutex outMutex;
+    std::atomic<size_t> nextPosition(0);
+    int threadHash = std::max(MIN_HASH, hashSize / threads);
+
+    auto runWorker = [&](int t){
+        SearchWorker worker(t, threadHash);
+        Hist history = Hist();
+
+        for (size_t i = nextPosition++; i < positions.size(); i = nextPosition++){
+            Board board = Board(positions[i].fen, false);
+            worker.clear();
+
+            std::string bestMove = "null", score, pv;
+            int depth = 0, seldepth = 0, elapsed = 0;
+            U64 nodes = 0;
+
+            if (!hasLegalMoves(board)){
+                // checkmate or stalemate, there is nothing to search
+                score = board.colorIsInCheck(board.getActivePlayer()) ? "{\"mate\": 0}" : jsonScore(0);
+            }else{
+                Search &search = worker.setPosition(board, limits, history);
+
+                std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now();
+                search.iterDeep();
+                elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+                for (auto &move : search.getPv()){
+                    pv += (pv.empty() ? "" : " ") + move.getNotation(board.getFrcMode());
+                }
+                bestMove = "\"" + search.getBestMove().getNotation(board.getFrcMode()) + "\"";
+                score    = jsonScore(search.getBestScore());
+                depth    = search.getCompletedDepth();
+                seldepth = std::max(search.getSeldepth(), depth);
+                nodes    = search.getNodes();
+            }
+
+            std::ostringstream line;
+            line << "{\"index\": " << i + 1
+                 << ", \"id\": \"" << jsonEscape(positions[i].id) << "\""
+                 << ", \"fen\": \"" << positions[i].fen << "\""
+                 << ", \"bestmove\": " << bestMove
+                 << ", \"score\": " << score
+                 << ", \"depth\": " << depth
+                 << ", \"seldepth\": " << seldepth
+                 << ", \"nodes\": " << nodes
+                 << ", \"time\": " << elapsed
+                 << ", \"pv\": \"" << pv << "\"}\n";
+
+            std::lock_guard<std::mutex> lock(outMutex);
+            out << line.str() << std::flush;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++){
+        workers.push_back(std::thread(runWorker, t));
+    }
+    for (auto &w : workers){
+        w.join();
+    }
+}
+
+void testSuite(int argCount, char* argValue[]){
+    if (argCount < 3){
+        std::cout << "Usage: testsuite <file> [threads] [hash] [movetime N] [nodes N] [depth N]" << std::endl;
+        return;
+    }
+
+    // positional: threads, hash; keywords with values anywhere
+    CmdArgs args(argCount, argValue, 3, {"depth", "nodes", "movetime"});
+    int threads  = args.positionalInt(0, 1);
+    int hashSize = args.positionalInt(1, 16);
+    Limits limits;
+    limits.depth    = args.getInt("depth", 0);
+    limits.nodes    = args.getU64("nodes", 0);
+    limits.moveTime = args.getInt("movetime", 0);
+
+    threads  = std::max(MIN_THREADS, std::min(threads, MAX_THREADS));
+    hashSize = std::max(MIN_HASH, std::min(hashSize, MAX_HASH));
+    limits.depth = std::max(0, std::min(limits.depth, MAX_SEARCH_DEPTH));
+    if (!limits.depth && !limits.nodes && !limits.moveTime){
+        limits.moveTime = TESTSUITE_MOVETIME;
+    }
+
+    std::vector<EpdPosition> positions = loadEpd(argValue[2]);
+
+    struct SuiteResult {
+        bool solved;
+        bool invalid; // bm/am moves are missing or can not be parsed
+        int  time;   // ms at which the solution was found and held
+        U64  nodes;  // nodes at that time
+        Move found;
+        int  totalTime;
+        U64  totalNodes;
+
+        SuiteResult() : solved(false), invalid(false), time(-1), nodes(0), totalTime(0), totalNodes(0) {};
+    };
+    std::vector<SuiteResult> results(positions.size());
+
+    std::mutex outMutex;
+    std::atomic<size_t> nextPosition(0);
+    int threadHash = std::max(MIN_HASH, hashSize / threads);
+
+    auto runWorker = [&](int t){
+        SearchWorker worker(t, threadHash);
+        Hist history = Hist();
+
+        for (size_t i = nextPosition++; i < positions.size(); i = nextPosition++){
+            Board board = Board(positions[i].fen, false);
+            worker.clear();
+
+            std::string expected = !positions[i].bestMoves.empty()  ? "bm " + positions[i].bestMoves
+                                 : !positions[i].avoidMoves.empty() ? "am " + positions[i].avoidMoves : "-";
+            SuiteResult &result = results[i];
+
+            if (!hasLegalMoves(board)){
+                // checkmate or stalemate: nothing to search, position is not solved
+                result = SuiteResult();
+                std::lock_guard<std::mutex> lock(outMutex);
+                printf("%5zu %-16.16s %-7s %-20.20s %-7s %8d ms %12llu nodes\n", i + 1, positions[i].id.c_str(),
+                       "failed", expected.c_str(), "none", 0, 0ULL);
+                std::cout << std::flush;
+                continue;
+            }
+
+            std::vector<Move> best, avoid;
+            if (!parseMoves(board, positions[i].bestMoves, best) ||
+                !parseMoves(board, positions[i].avoidMoves, avoid) || (best.empty() && avoid.empty())){
+                // nothing to check the search against, position is not scored
+                result = SuiteResult();
+                result.invalid = true;
+                std::lock_guard<std::mutex> lock(outMutex);
+                printf("%5zu %-16.16s %-7s %-20.20s %-7s %8d ms %12llu nodes\n", i + 1, positions[i].id.c_str(),
+                       "invalid", expected.c_str(), "none", 0, 0ULL);
+                std::cout << std::flush;
+                continue;
+            }
+
+            auto isCorrect = [&](Move move){
+                if (!best.empty() && !containsMove(best, move)) return false;
+                return !containsMove(avoid, move);
+            };
+
+            Search &search = worker.setPosition(board, limits, history);
+
+            result.time = -1;
+            result.nodes = 0;
+            search.setIterationHook([&](Move move, int, U64 nodes, int elapsed){
+                if (!isCorrect(move)){
+                    result.time = -1;
+                }else if (result.time < 0){
+                    result.time  = elapsed;
+                    result.nodes = nodes;
+                }
+            });
+
+            std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now();
+            search.iterDeep();
+            int elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            search.setIterationHook(Search::IterationHook());
+
+            result.found = search.getBestMove();
+            result.totalTime  = elapsed;
+            result.totalNodes = search.getNodes();
+            result.solved = isCorrect(result.found);
+            if (!result.solved){
+                result.time = -1;
+            }else if (result.time < 0){
+                // best move changed in the last, unfinished iteration
+                result.time  = elapsed;
+                result.nodes = result.totalNodes;
+            }
+
+            std::lock_guard<std::mutex> lock(outMutex);
+            printf("%5zu %-16.16s %-7s %-20.20s %-7s %8d ms %12llu nodes\n", i + 1, positions[i].id.c_str(),
+                   result.solved ? "solved" : "failed", expected.c_str(),
+                   result.found.getNotation(board.getFrcMode()).c_str(),
+                   result.solved ? result.time : elapsed, result.solved ? result.nodes : result.totalNodes);
+            std::cout << std::flush;
+        }
+    };
+
+    std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++){
+        workers.push_back(std::thread(runWorker, t));
+    }
+    for (auto &w : workers){
+        w.join();
+    }
+    int elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<int> times;
+    std::vector<U64> nodes;
+    U64 searchTime = 0;
+    size_t invalid = 0;
+    for (auto &result : results){
+        searchTime += result.totalTime;
+        if (result.invalid) invalid++;
+        if (!result.solved) continue;
+        times.push_back(result.time);
+        nodes.push_back(result.nodes);
+    }
+    std::sort(times.begin(), times.end());
+    std::sort(nodes.begin(), nodes.end());
+
+    std::cout << "==========================" << std::endl;
+    printf("Solved:         %zu / %zu\n", times.size(), positions.size() - invalid);
+    printf("Invalid:        %zu\n", invalid);
+    printf("Total time:     %d ms (search %llu ms)\n", elapsed, searchTime);
+    printf("Time to solve:  p50 %d  p75 %d  p90 %d  max %d ms\n",
+           percentile(times, 50), percentile(times, 75), percentile(times, 90), percentile(times, 100));
+    printf("Nodes to solve: p50 %llu  p75 %llu  p90 %llu  max %llu\n",
+           percentile(nodes, 50), percentile(nodes, 75), percentile(nodes, 90), percentile(nodes, 100));
+    std::cout << std::flush;
+}
@@ -0,0 +1,57 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef ANALYZE_H
+#define ANALYZE_H
+
+#define ANALYZE_SEARCH_DEPTH    (12)
+#define TESTSUITE_MOVETIME      (1000)
+
+/**
+ * @brief Analyzes positions of an EPD/FEN file in parallel
+ *
+ * Command line: analyze <file> [threads] [hash] [depth N] [nodes N] [movetime N] [output FILE]
+ *
+ * Every thread takes the next position and searches it alone with its own
+ * TT, hash (MB) is split between the threads. Results are printed as
+ * JSON lines (index, EPD id, FEN, best move, score, depth, nodes, time, PV)
+ * in order of completion, to the output file or to standard output.
+ * Without limits positions are searched to ANALYZE_SEARCH_DEPTH.
+ * Positions without legal moves are not searched: best move is null,
+ * score is {"mate": 0} for a checkmate and {"cp": 0} for a stalemate.
+ */
+void analyze(int, char* []);
+
+/**
+ * @brief Runs an EPD test suite (WAC, STS...) in parallel
+ *
+ * Command line: testsuite <file> [threads] [hash] [movetime N] [nodes N] [depth N]
+ *
+ * Every position is searched with the given limits (TESTSUITE_MOVETIME ms
+ * by default) and is solved if the final best move is one of the "bm"
+ * moves and none of the "am" moves. Solution time and nodes are taken
+ * from the iteration since which the best move stayed correct.
+ * Positions without legal moves are not searched and count as failed.
+ * Positions without "bm" and "am" moves or with a move that is not legal
+ * in the position are reported as invalid, they are not searched and
+ * not counted in the solved total.
+ * Summary shows solved count, total time and time/nodes to solution
+ * percentiles of the solved positions.
+ */
+void testSuite(int, char* []);
+
+#endif
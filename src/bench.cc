@@ -18,43 +18,299 @@
 #include "bench.h"
 #include "searchdata.h"
 #include "search.h"
+#include "searchworker.h"
+#include "cmdargs.h"
 #include "move.h"
 #include "timer.h"
 #include <iostream>
+#include <fstream>
 #include <memory>
+#include <vector>
+#include <thread>
+#include <atomic>
 
 
 extern HASH         * myHASH;
 extern OrderingInfo * myOrdering;
+extern int            myTHREADSCOUNT;
 
-void myBench(){
-    std::cout << "Bench started..." << std::endl;
-    std::chrono::time_point<std::chrono::steady_clock> timer_start = std::chrono::steady_clock::now();
-    Board board = Board();
-    int nodes_total = 0;
+namespace {
 
-    Limits limits;
-    limits.depth = BENCH_SEARCH_DEPTH;
+struct BenchResult {
+    std::string fen;
+    std::string bestMove;
+    int         score;
+    U64         nodes;
+    U64         ttProbes;
+    U64         ttHits;
+    int         time;
+
+    BenchResult() : score(0), nodes(0), ttProbes(0), ttHits(0), time(0) {};
+};
+
+int elapsedSince(std::chrono::time_point<std::chrono::steady_clock> start){
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool isNumber(const std::string &s){
+    return !s.empty() && s.find_first_not_of("0123456789") == std::string::npos;
+}
+
+std::vector<std::string> loadPositions(const std::string &path){
+    std::vector<std::string> positions;
+
+    if (path.empty() || path == "default"){
+        for (int i = 0; i < BENCH_POS_NUMBER; i++){
+            positions.push_back(BENCH_POSITION[i]);
+        }
+        return positions;
+    }
+
+    std::ifstream file(path);
+    if (!file){
+        fatal("Failed to open bench position file " + path);
+    }
+
+    std::string line;
+    while (std::getline(file, line)){
+        if (line.find_first_not_of(" \t\r") == std::string::npos || line[0] == '#') continue;
+        positions.push_back(normalizeFen(line));
+    }
+
+    return positions;
+}
+
+// TT hit rate in percent, n/a (null in JSON) if nothing was searched
+std::string hitRate(U64 probes, U64 hits, bool json){
+    if (!probes) return json ? "null" : "  n/a";
+
+    char text[16];
+    snprintf(text, sizeof(text), json ? "%.2f" : "%5.1f%%", 100.0 * hits / probes);
+    return text;
+}
+
+// Lazy SMP: all threads search the same position and share the global TT
+void benchShared(const std::vector<std::string> &positions, std::vector<BenchResult> &results, Limits limits, int threads){
     Hist history = Hist();
-    std::shared_ptr<Search> search;
-
-    for (int i = 0; i < BENCH_POS_NUMBER; i++){
-        int curNodes = 0;
-        board = Board(BENCH_POSITION[i], false);
-        search = std::make_shared<Search>(board, limits, history, myOrdering, false);
-        search->iterDeep();
-        curNodes = search->getNodes();
-        nodes_total += curNodes;
+    Board board = Board();
+    std::vector<std::shared_ptr<OrderingInfo>> orderings;
+    std::vector<std::shared_ptr<Search>> searches;
+    std::vector<std::thread> helpers(threads);
+    std::atomic<bool> stopSignal(false);
+
+    myTHREADSCOUNT = threads;
+
+    for (size_t i = 0; i < positions.size(); i++){
+        board = Board(positions[i], false);
         myHASH->HASH_Clear();
         myOrdering->clearAllHistory();
-        printf("Position [# %2d] Best: %6s %5i cp  Nodes: %12i", i + 1,search->getBestMove().getNotation(board.getFrcMode()).c_str(),
-                 search->getBestScore(), curNodes);
-        std::cout << std::endl;
+
+        for (int t = 0; t < threads; t++){
+            if (t >= (int) searches.size()){
+                orderings.push_back(t == 0 ? std::shared_ptr<OrderingInfo>() : std::make_shared<OrderingInfo>());
+                searches.push_back(std::make_shared<Search>(board, limits, history, t == 0 ? myOrdering : orderings[t].get(), false, t));
+                searches[t]->setStopSignal(&stopSignal);
+            }else{
+                searches[t]->setPosition(board, limits, history);
+            }
+            if (t > 0) orderings[t]->clearAllHistory();
+        }
+
+        std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now();
+
+        for (int t = 1; t < threads; t++){
+            helpers[t] = std::thread(&Search::iterDeep, searches[t]);
+        }
+
+        // main search stops helpers through the shared signal
+        searches[0]->iterDeep();
+
+        for (int t = 1; t < threads; t++){
+            helpers[t].join();
+        }
+
+        BenchResult &r = results[i];
+        r.time     = elapsedSince(start);
+        r.fen      = positions[i];
+        std::vector<Search *> threadPtrs;
+        for (auto &s : searches) threadPtrs.push_back(s.get());
+        Search * best = Search::selectBestThread(threadPtrs);
+
+        r.bestMove = best->getBestMove().getNotation(board.getFrcMode());
+        r.score    = best->getBestScore();
+        r.nodes    = Search::getTotalNodes();
+        for (int t = 0; t < threads; t++){
+            r.ttProbes += searches[t]->getTTProbes();
+            r.ttHits   += searches[t]->getTTHits();
+        }
+    }
+}
+
+// Deterministic: every thread takes next unsearched position and searches it alone
+// with its own TT and ordering, so results are identical to a single thread bench
+void benchDeterministic(const std::vector<std::string> &positions, std::vector<BenchResult> &results, Limits limits, int threads, int hashSize){
+    std::atomic<size_t> nextPosition(0);
+
+    auto runWorker = [&](int t){
+        SearchWorker worker(t, hashSize);
+        Hist history = Hist();
+
+        for (size_t i = nextPosition++; i < positions.size(); i = nextPosition++){
+            Board board = Board(positions[i], false);
+            worker.clear();
+            Search &search = worker.setPosition(board, limits, history);
+
+            std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now();
+            search.iterDeep();
+
+            BenchResult &r = results[i];
+            r.time     = elapsedSince(start);
+            r.fen      = positions[i];
+            r.bestMove = search.getBestMove().getNotation(board.getFrcMode());
+            r.score    = search.getBestScore();
+            r.nodes    = search.getNodes();
+            r.ttProbes = search.getTTProbes();
+            r.ttHits   = search.getTTHits();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++){
+        workers.push_back(std::thread(runWorker, t));
+    }
+    for (auto &w : workers){
+        w.join();
+    }
+}
+
+// Time to depth of shared (Lazy SMP) search with 1, 2, 4, ... threads
+void benchScaling(const std::vector<std::string> &positions, Limits limits, int maxThreads, int hashSize){
+    myHASH->HASH_Initalize_MB(hashSize);
+
+    std::vector<int> threadCounts;
+    for (int t = 1; t < maxThreads; t *= 2){
+        threadCounts.push_back(t);
+    }
+    threadCounts.push_back(maxThreads);
+
+    printf("Time to depth %d, hash %d MB\n", limits.depth, hashSize);
+    printf("%7s %12s %10s %12s %9s %8s\n", "Threads", "Nodes", "Time ms", "NPS", "Speedup", "Nodes x");
+
+    int baseTime = 0;
+    U64 baseNodes = 0;
+    for (int threads : threadCounts){
+        std::vector<BenchResult> results(positions.size());
+        benchShared(positions, results, limits, threads);
+
+        int time = 0;
+        U64 nodes = 0;
+        for (auto &r : results){
+            time  += r.time;
+            nodes += r.nodes;
+        }
+        if (threads == 1){
+            baseTime  = time;
+            baseNodes = nodes;
+        }
+
+        printf("%7d %12llu %10d %12llu %9.2f %8.2f\n", threads, nodes, time, 1000 * nodes / (time + 1),
+               (double) (baseTime + 1) / (time + 1), (double) nodes / std::max(baseNodes, (U64) 1));
+        std::cout << std::flush;
+    }
+}
+
+}
+
+std::string normalizeFen(const std::string &line){
+    std::istringstream is(line);
+    std::string token, fen;
+
+    for (int i = 0; i < 4 && is >> token; i++){
+        fen += (i ? " " : "") + token;
+    }
+
+    std::string halfmove, fullmove;
+    is >> halfmove >> fullmove;
+    if (isNumber(halfmove) && isNumber(fullmove)){
+        fen += " " + halfmove + " " + fullmove;
+    }else{
+        fen += " 0 1";
+    }
+
+    return fen;
+}
+
+void myBench(int argCount, char* argValue[]){
+    // positional: depth, threads, hash, position file; keywords anywhere
+    CmdArgs args(argCount, argValue, 2, {}, {"json", "deterministic", "scaling"});
+    int depth    = args.positionalInt(0, BENCH_SEARCH_DEPTH);
+    int threads  = args.positionalInt(1, 1);
+    int hashSize = args.positionalInt(2, 16);
+    std::string posFile = args.positional(3, "default");
+    bool json          = args.has("json");
+    bool deterministic = args.has("deterministic");
+    bool scaling       = args.has("scaling");
+
+    depth    = std::max(1, std::min(depth, MAX_SEARCH_DEPTH));
+    threads  = std::max(MIN_THREADS, std::min(threads, MAX_THREADS));
+    hashSize = std::max(MIN_HASH, std::min(hashSize, MAX_HASH));
+
+    std::vector<std::string> positions = loadPositions(posFile);
+    std::vector<BenchResult> results(positions.size());
+
+    Limits limits;
+    limits.depth = depth;
+
+    if (scaling){
+        benchScaling(positions, limits, threads, hashSize);
+        return;
+    }
+
+    if (!json) std::cout << "Bench started..." << std::endl;
+    std::chrono::time_point<std::chrono::steady_clock> timer_start = std::chrono::steady_clock::now();
+
+    if (deterministic){
+        benchDeterministic(positions, results, limits, threads, hashSize);
+    }else{
+        myHASH->HASH_Initalize_MB(hashSize);
+        benchShared(positions, results, limits, threads);
+    }
+
+    int elapsed = elapsedSince(timer_start);
+    U64 nodes_total = 0, probes_total = 0, hits_total = 0;
+    for (auto &r : results){
+        nodes_total  += r.nodes;
+        probes_total += r.ttProbes;
+        hits_total   += r.ttHits;
+    }
+    U64 nps_total = 1000 * nodes_total / (elapsed + 1);
+
+    if (json){
+        std::cout << "{\"depth\": " << depth << ", \"threads\": " << threads << ", \"hash\": " << hashSize;
+        std::cout << ", \"mode\": \"" << (deterministic ? "deterministic" : "shared") << "\", \"positions\": [";
+        for (size_t i = 0; i < results.size(); i++){
+            BenchResult &r = results[i];
+            printf("%s\n  {\"index\": %d, \"fen\": \"%s\", \"bestmove\": \"%s\", \"score\": %d, \"nodes\": %llu, \"time\": %d, \"nps\": %llu, \"tthitrate\": %s}",
+                   i ? "," : "", (int) i + 1, r.fen.c_str(), r.bestMove.c_str(), r.score, r.nodes, r.time,
+                   1000 * r.nodes / (r.time + 1), hitRate(r.ttProbes, r.ttHits, true).c_str());
+        }
+        printf("\n ],\n \"total\": {\"nodes\": %llu, \"time\": %d, \"nps\": %llu, \"tthitrate\": %s}}\n",
+               nodes_total, elapsed, nps_total, hitRate(probes_total, hits_total, true).c_str());
+        std::cout << std::flush;
+        return;
+    }
+
+    for (size_t i = 0; i < results.size(); i++){
+        BenchResult &r = results[i];
+        printf("Position [# %2d] Best: %6s %5i cp  Nodes: %12llu  Time: %7d ms  NPS: %9llu  TT hits: %s\n",
+               (int) i + 1, r.bestMove.c_str(), r.score, r.nodes, r.time, 1000 * r.nodes / (r.time + 1),
+               hitRate(r.ttProbes, r.ttHits, false).c_str());
     }
 
-    int elapsed =std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - timer_start).count();
     std::cout << "==============================================================="<<std::endl;
-    printf("OVERALL: %12d nodes %8d nps\n", nodes_total, (int) (1000.0f * nodes_total / (elapsed + 1)));
+    printf("Depth: %d  Threads: %d  Hash: %d MB  Mode: %s\n", depth, threads, hashSize, deterministic ? "deterministic" : "shared");
+    printf("Time: %d ms  TT hits: %s\n", elapsed, hitRate(probes_total, hits_total, false).c_str());
+    printf("OVERALL: %12llu nodes %8llu nps\n", nodes_total, nps_total);
     std::cout << std::flush;
 };
 
@@ -28,10 +28,31 @@
 
 /**
  * @brief returns bench of an engine
+ *
+ * Command line: bench [depth] [threads] [hash] [posfile] [json] [deterministic] [scaling]
+ *
+ * depth, threads and hash (MB) are taken in this order, posfile is a file with
+ * one FEN/EPD per line ("default" - built-in positions).
+ * "json" prints results in JSON instead of text.
+ * "deterministic" searches different positions in parallel, each thread with
+ * its own TT of the given size, so node counts do not depend on thread count.
+ * Otherwise all threads search the same position sharing TT (Lazy SMP).
+ * "scaling" reports time to depth of shared search with 1, 2, 4, ... up to
+ * the given number of threads.
  */
-void myBench();
+void myBench(int, char* []);
 
 
+/**
+ * @brief Takes FEN or EPD line and returns full FEN
+ *
+ * EPD opcodes are dropped, missing move counters are added.
+ *
+ * @param line FEN or EPD line
+ * @return FEN with all 6 fields
+ */
+std::string normalizeFen(const std::string &);
+
 void testSEE();
 
 void testMove();
@@ -21,9 +21,10 @@
 #include "eval.h"
 #include "bitutils.h"
 #include "attacks.h"
+#include "kpkbitbase.h"
 #include <cstring>
-
-uint8_t KPK_Bitbase[KPK_SIZE / 8];
+#include <fstream>
+#include <vector>
 
 
 // Bitbase code is basically copy-paste (with some minor semantic changes) of the Stash code
@@ -126,7 +127,7 @@ void Bitbase::kpk_classify( kpk_position *position, kpk_position *table){
 }
 
 
-void Bitbase::init_kpk(){
+void Bitbase::generate_kpk(uint8_t *bitbase){
     kpk_position *kpkTable = (kpk_position *) malloc(sizeof(kpk_position) * KPK_SIZE);
 
     if (kpkTable == NULL)
@@ -138,7 +139,7 @@ void Bitbase::init_kpk(){
     unsigned int index;
     bool repeat;
 
-    std::memset(KPK_Bitbase, 0, sizeof(KPK_Bitbase));
+    std::memset(bitbase, 0, KPK_SIZE / 8);
     for (index = 0; index < KPK_SIZE; ++index) kpk_set(kpkTable + index, index);
 
     do {
@@ -153,12 +154,26 @@ void Bitbase::init_kpk(){
 
 
     for (index = 0; index < KPK_SIZE; ++index)
-        if (kpkTable[index].result == KPK_WIN) KPK_Bitbase[index / 8] |= 1 << (index % 8);
+        if (kpkTable[index].result == KPK_WIN) bitbase[index / 8] |= 1 << (index % 8);
 
     free(kpkTable);
 }
 
 
+void Bitbase::init_kpk(){
+    // Bitbase is embedded (kpkbitbase.h, "make kpkgen" regenerates it),
+    // with _KPK_CHECK_ it is verified against the generator
+#ifdef _KPK_CHECK_
+    static uint8_t generated[KPK_SIZE / 8];
+    generate_kpk(generated);
+
+    if (std::memcmp(generated, KPK_Bitbase, sizeof(generated)) != 0){
+        fatal("Embedded KPK bitbase does not match the generator, run \"make kpkgen\"");
+    }
+#endif
+}
+
+
 int Bitbase::eval_by_kpk(const Board &board, Color winningSide){
     int winningKing = _bitscanForward(board.getPieces(winningSide, KING));
     int winningPawn = _bitscanForward(board.getPieces(winningSide, PAWN));
@@ -174,4 +189,100 @@ int Bitbase::eval_by_kpk(const Board &board, Color winningSide){
                         : 0;
 
     return (winningSide == board.getActivePlayer() ? score : -score);
-}
\ No newline at end of file
+}
+
+// Generic bitbases of 4-man endgames
+//
+// Positions are indexed with the strong side as white moving up the board,
+// leading pawn of the endgame is kept on files a-d. Bit is set if the strong
+// side wins. Bitbases are generated by exact retrograde analysis with
+// "make bbgen" (tools/bbgen.cc), engine only loads them.
+
+const Bitbase::egBitbaseSpec Bitbase::EG_BITBASE_SPECS[Bitbase::BB_NUMBER] = {
+    {"KPKP", {WHITE, BLACK}, {PAWN, PAWN}},
+    {"KRKP", {BLACK, WHITE}, {PAWN, ROOK}},
+    {"KBPK", {WHITE, WHITE}, {PAWN, BISHOP}},
+};
+
+namespace {
+
+const char EG_MAGIC[4] = {'E', 'Q', 'B', 'B'};
+
+std::vector<uint8_t> egBitbases[Bitbase::BB_NUMBER];
+
+std::string egFileName(const std::string &path, Bitbase::egBitbase bb){
+    return path + "/" + Bitbase::EG_BITBASE_SPECS[bb].name + ".bb";
+}
+
+bool egLoadBitbase(Bitbase::egBitbase bb, const std::string &fileName){
+    std::ifstream file(fileName, std::ios::binary);
+    char magic[4];
+    uint32_t size = 0;
+
+    if (!file.read(magic, 4) || !file.read((char *) &size, sizeof(size))) return false;
+    if (std::memcmp(magic, EG_MAGIC, 4) != 0 || size != Bitbase::EG_BITBASE_SIZE / 8) return false;
+
+    std::vector<uint8_t> data(size);
+    if (!file.read((char *) data.data(), size)) return false;
+
+    egBitbases[bb] = data;
+    return true;
+}
+
+}
+
+unsigned int Bitbase::bitbase_index(Color stm, const int * squares){
+    int mirror = _col(squares[2]) >= 4 ? 7 : 0;
+    int p0 = squares[2] ^ mirror;
+
+    return (unsigned int) (stm == BLACK)
+         | (unsigned int) (squares[0] ^ mirror) << 1
+         | (unsigned int) (squares[1] ^ mirror) << 7
+         | (unsigned int) ((_row(p0) - 1) * 4 + _col(p0) + 24 * (squares[3] ^ mirror)) << 13;
+}
+
+bool Bitbase::save_bitbase(egBitbase bb, const std::string &path, const std::vector<uint8_t> &data){
+    std::ofstream file(egFileName(path, bb), std::ios::binary);
+    uint32_t size = data.size();
+
+    file.write(EG_MAGIC, 4);
+    file.write((const char *) &size, sizeof(size));
+    file.write((const char *) data.data(), size);
+    return file.good();
+}
+
+void Bitbase::init_bitbases(const std::string &path){
+    for (int bb = 0; bb < BB_NUMBER; bb++){
+        egBitbases[bb].clear();
+    }
+
+    if (path.empty() || path == "<empty>") return;
+
+    for (int bb = 0; bb < BB_NUMBER; bb++){
+        if (!egLoadBitbase((egBitbase) bb, egFileName(path, (egBitbase) bb))){
+            std::cout << "info string No " << EG_BITBASE_SPECS[bb].name << " bitbase in " << path
+                      << ", generate it with \"make bbgen\"" << std::endl;
+        }
+    }
+}
+
+bool Bitbase::bitbase_loaded(egBitbase bb){
+    return !egBitbases[bb].empty();
+}
+
+bool Bitbase::bitbase_is_winning(egBitbase bb, const Board &board, Color strong){
+    const egBitbaseSpec &spec = EG_BITBASE_SPECS[bb];
+    Color weak = getOppositeColor(strong);
+    int flip = strong == WHITE ? 0 : a8;
+
+    int squares[4];
+    squares[0] = _bitscanForward(board.getPieces(strong, KING)) ^ flip;
+    squares[1] = _bitscanForward(board.getPieces(weak, KING)) ^ flip;
+    for (int i = 0; i < 2; i++){
+        Color color = spec.color[i] == WHITE ? strong : weak;
+        squares[i + 2] = _bitscanForward(board.getPieces(color, spec.type[i])) ^ flip;
+    }
+
+    unsigned int index = bitbase_index(board.getActivePlayer() == strong ? WHITE : BLACK, squares);
+    return egBitbases[bb][index / 8] & (1 << (index % 8));
+}
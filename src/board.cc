@@ -20,6 +20,7 @@
 #include "bitutils.h"
 #include "attacks.h"
 #include "eval.h"
+#include "stats.h"
 #include <sstream>
 #include <cstring>
 
@@ -141,6 +142,14 @@ ZKey Board::getpCountKey() const {
     return _pCountKey;
 }
 
+U64 Board::getMaterialKey() const {
+    return _materialKey;
+}
+
+bool Board::isSpEvalCandidate() const {
+    return _materialKey < SP_EVAL_MATERIAL_LIMIT;
+}
+
 PSquareTable Board::getPSquareTable() const {
   return _pst;
 }
@@ -296,44 +305,29 @@ void Board::setToFen(std::string fenString, bool isFrc) {
   fenStream >> token;
   _castlingRights = 0;
   for (auto currChar : token) {
+    // K and Q (X-FEN) mean the outermost rook on the back rank
     U64 rook = 0;
     int king = 0;
     switch (currChar) {
       case 'K':
-        rook = _pieces[WHITE][ROOK];
         king = _bitscanForward(_pieces[WHITE][KING]);
-        while (rook)
-        {
-            int sq = _popLsb(rook);
-            if (sq > king) _castlingRights |= (ONE << sq);
-        }
+        rook = _pieces[WHITE][ROOK] & RANK_1 & ~((ONE << king) - 1);
+        if (rook) _castlingRights |= ONE << _bitscanReverse(rook);
         break;
       case 'Q':
-        rook = _pieces[WHITE][ROOK];
         king = _bitscanForward(_pieces[WHITE][KING]);
-        while (rook)
-        {
-            int sq = _popLsb(rook);
-            if (sq < king) _castlingRights |= (ONE << sq);
-        }
+        rook = _pieces[WHITE][ROOK] & RANK_1 & ((ONE << king) - 1);
+        if (rook) _castlingRights |= ONE << _bitscanForward(rook);
         break;
       case 'k':
-        rook = _pieces[BLACK][ROOK];
         king = _bitscanForward(_pieces[BLACK][KING]);
-        while (rook)
-        {
-            int sq = _popLsb(rook);
-            if (sq > king) _castlingRights |= (ONE << sq);
-        }
+        rook = _pieces[BLACK][ROOK] & RANK_8 & ~((ONE << king) - 1);
+        if (rook) _castlingRights |= ONE << _bitscanReverse(rook);
         break;
       case 'q':
-        rook = _pieces[BLACK][ROOK];
         king = _bitscanForward(_pieces[BLACK][KING]);
-        while (rook)
-        {
-            int sq = _popLsb(rook);
-            if (sq < king) _castlingRights |= (ONE << sq);
-        }
+        rook = _pieces[BLACK][ROOK] & RANK_8 & ((ONE << king) - 1);
+        if (rook) _castlingRights |= ONE << _bitscanForward(rook);
         break;
       case 'A': _castlingRights |= (ONE << a1);
         break;
@@ -397,6 +391,12 @@ void Board::setToFen(std::string fenString, bool isFrc) {
   _pawnStructureZkey.setFromPawnStructure(*this);
   _pCountKey.setFromPieceCounts(*this);
 
+  _materialKey = 0;
+  for (auto pieceType : {PAWN, ROOK, KNIGHT, BISHOP, QUEEN}) {
+    _materialKey += _popCount(getPieces(WHITE, pieceType)) * materialKey(WHITE, pieceType);
+    _materialKey += _popCount(getPieces(BLACK, pieceType)) * materialKey(BLACK, pieceType);
+  }
+
   _pst = PSquareTable(*this);
   _nnue = nullptr;
 
@@ -469,6 +469,7 @@ void Board::_removePiece(Color color, PieceType pieceType, int squareIndex) {
   }
 
   _pCountKey.flipPieceCount(color, pieceType, _popCount(getPieces(color, pieceType)) + 1);
+  _materialKey -= materialKey(color, pieceType);
   _zKey.flipPiece(color, pieceType, squareIndex);
   _pst.removePiece(color, pieceType, squareIndex);
 }
@@ -483,6 +484,7 @@ void Board::_addPiece(Color color, PieceType pieceType, int squareIndex) {
   _occupied |= square;
 
   _pCountKey.flipPieceCount(color, pieceType, _popCount(getPieces(color, pieceType)));
+  _materialKey += materialKey(color, pieceType);
   _zKey.flipPiece(color, pieceType, squareIndex);
   _pst.addPiece(color, pieceType, squareIndex);
 }
@@ -1174,6 +1176,7 @@ inline bool Board::calculateBoardDifference(U64 (* otherPieces)[2][6]){
     bool isResetNeeded = _nnue->resetNeeded(_updSchedule.movingPiece, _updSchedule.from, _updSchedule.to, _updSchedule.color);
     // Reset is needed
     if(isResetNeeded){
+        STATS_ADD(ST_NN_RESET);
         // good color - > color of the accumulator that does not need to be updated
         Color goodcolor = getOppositeColor(_updSchedule.color);
         int curbucket = _nnue->getCurrentBucket(_updSchedule.to, _updSchedule.color);
@@ -1218,6 +1221,7 @@ inline bool Board::calculateBoardDifference(U64 (* otherPieces)[2][6]){
        if ( calculateBoardDifference(&(*entry)[curside][_updSchedule.color][curbucket]._pieces) &&
         (*entry)[curside][_updSchedule.color][curbucket].isReady == true){
 
+            STATS_ADD(ST_FINNY_DIFF);
             // Update accumulator based on difference in boards and copy to current accumulator point
             (*cache)[curside][curbucket].addSubDifference(*this,  _updSchedule.color, &(* entry)[curside][_updSchedule.color][curbucket]._pieces);
             memcpy(_nnue->getHalfAccumulatorPtr(_updSchedule.color), nncache, sizeof(int16_t) * NNUE_HIDDEN);
@@ -1225,6 +1229,7 @@ inline bool Board::calculateBoardDifference(U64 (* otherPieces)[2][6]){
         }else{
             // otherwise do half reset
             // half reset "bad" part
+            STATS_ADD(ST_FINNY_REFRESH);
             _nnue->halfReset(*this, _updSchedule.color);
             // save to finny table
             (*entry)[curside][_updSchedule.color][curbucket].isReady = true;
@@ -1237,6 +1242,7 @@ inline bool Board::calculateBoardDifference(U64 (* otherPieces)[2][6]){
 
     // Full reset is not needed
     // copy accumulator and proceed
+    STATS_ADD(ST_NN_INCREMENTAL);
     *(_nnue + 1) = *_nnue;
     _nnue = _nnue + 1;
 
@@ -1269,6 +1275,32 @@ inline bool Board::calculateBoardDifference(U64 (* otherPieces)[2][6]){
 }
 
 
+void Board::refreshAccumulator(FinnyEntry (*entry)[2][2][NNUE_BUCKETS], NNueEvaluation (*cache)[2][NNUE_BUCKETS]){
+
+    for (auto color : {WHITE, BLACK}){
+        int kingSq = _bitscanForward(_pieces[color][KING]);
+        int curbucket = _nnue->getCurrentBucket(kingSq, color);
+        int curside = (_col(kingSq) > 3);
+        FinnyEntry * finny = &(*entry)[curside][color][curbucket];
+        int16_t * nncache = (*cache)[curside][curbucket].getHalfAccumulatorPtr(color);
+
+        // Finny entry is ready and close enough - apply only the difference,
+        // otherwise do half reset of the cached accumulator
+        if (finny->isReady && calculateBoardDifference(&finny->_pieces)){
+            (*cache)[curside][curbucket].addSubDifference(*this, color, &finny->_pieces);
+        }else{
+            (*cache)[curside][curbucket].halfReset(*this, color);
+            finny->isReady = true;
+        }
+
+        memcpy(_nnue->getHalfAccumulatorPtr(color), nncache, sizeof(int16_t) * NNUE_HIDDEN);
+        memcpy(finny->_pieces, _pieces, sizeof(_pieces));
+    }
+
+    _updDone = true;
+}
+
+
 void Board::_scheduleUpdateMove(const Board &board, Color c, PieceType moving, unsigned int from, unsigned int to){
 
     _updSchedule.type = NN_MOVE;
@@ -191,6 +191,17 @@ class Board {
 
   ZKey getpCountKey() const;
 
+  /**
+   * @brief Returns the material key of this board (see materialKey())
+   */
+  U64 getMaterialKey() const;
+
+  /**
+   * @brief Returns false if there are more than LARGEST_SP_EVAL pieces on the board,
+   * so no special endgame evaluation can apply
+   */
+  bool isSpEvalCandidate() const;
+
   /**
    * @brief Returns the Piece Square Table of this board for its current state.
    *
@@ -274,6 +285,14 @@ class Board {
   U64 getCastlingRights() const;
 
   void performUpdate(FinnyEntry (*)[2][2][NNUE_BUCKETS], NNueEvaluation (*)[2][NNUE_BUCKETS]);
+
+  /**
+   * @brief Rebuilds current accumulator of the board from the Finny table.
+   *
+   * Only difference between the cached boards and this board is applied,
+   * so a position close to the previously searched one is refreshed cheaply.
+   */
+  void refreshAccumulator(FinnyEntry (*)[2][2][NNUE_BUCKETS], NNueEvaluation (*)[2][NNUE_BUCKETS]);
   inline bool calculateBoardDifference(U64 (*)[2][6]);
 
   // check if the move is pseudo-legal on the given board
@@ -357,6 +376,11 @@ class Board {
 
   ZKey _pCountKey;
 
+  /**
+   * @brief Counts of pieces of every color and type, see materialKey()
+   */
+  U64 _materialKey;
+
  private:
 
   /**
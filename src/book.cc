@@ -17,10 +17,13 @@
 */
 #include "book.h"
 #include "bitutils.h"
-#include <fstream>
 #include <cmath>
 #include <iostream>
 #include <random>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 const U64 Book::RANDOM_PIECE[768] = {
     0x9D39247E33776D41, 0x2AF7398005AAA5C7, 0x44DB015024623547, 0x9C15F73E62A76AE2,
@@ -228,68 +231,92 @@ const U64 Book::RANDOM_ENPASSANT[8] = {
 
 const U64 Book::RANDOM_TURN = 0xF8D626AAAF278509;
 
-Book::Book(std::string path) {
+Book::Book(std::string path) : _entries(0) {
   _initMoves(path);
 }
 
-Book::Book() {
+Book::Book() : _entries(0) {
 
 }
 
 void Book::_initMoves(std::string path) {
-  std::ifstream bookFile(path, std::ios::binary);
-  bookFile.seekg(0);
-
-  U64 key;
-  unsigned short move, weight;
-  char entry[16];
-
-  while (bookFile) {
-    bookFile.read(entry, 16);
-
-    // key/move/weight/learn are stored high byte first
-    key = ((U64) entry[0] << 56) |
-        (((U64) entry[1] & 0xFF) << 48) |
-        (((U64) entry[2] & 0xFF) << 40) |
-        (((U64) entry[3] & 0xFF) << 32) |
-        (((U64) entry[4] & 0xFF) << 24) |
-        (((U64) entry[5] & 0xFF) << 16) |
-        (((U64) entry[6] & 0xFF) << 8) |
-        ((U64) entry[7] & 0xFF);
-    move = ((entry[8] & 0xFF) << 8) | (entry[9] & 0xFF);
-    weight = ((entry[10] & 0xFF) << 8) | (entry[11] & 0xFF);
-
-    auto moveWeightPair = std::make_pair(move, weight);
-    auto moveVec = std::vector < std::pair < unsigned short,
-    unsigned short >> (1, moveWeightPair);
-
-    auto insertResult = _content.insert(std::make_pair(key, moveVec));
-    if (!insertResult.second) {
-      insertResult.first->second.push_back(moveWeightPair);
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    std::cerr << "Failed to open book " << path << std::endl;
+    return;
+  }
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) == -1 || fileStat.st_size < (off_t) ENTRY_SIZE) {
+    close(fd);
+    return;
+  }
+
+  size_t size = fileStat.st_size;
+  void * data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (data == MAP_FAILED) {
+    std::cerr << "Failed to map book " << path << std::endl;
+    return;
+  }
+
+  // probes jump over the whole file
+  madvise(data, size, MADV_RANDOM);
+
+  _data = std::shared_ptr<const unsigned char>((const unsigned char *) data,
+                                               [size](const unsigned char * p) { munmap((void *) p, size); });
+  _entries = size / ENTRY_SIZE;
+}
+
+U64 Book::_read(size_t offset, int bytes) const {
+  const unsigned char * p = _data.get() + offset;
+  U64 value = ZERO;
+  for (int i = 0; i < bytes; i++) {
+    value = (value << 8) | p[i];
+  }
+  return value;
+}
+
+size_t Book::_findFirst(U64 key) const {
+  // lower bound: first entry with key not less than the given one
+  size_t low = 0, high = _entries;
+  while (low < high) {
+    size_t mid = low + (high - low) / 2;
+    if (_read(mid * ENTRY_SIZE, 8) < key) {
+      low = mid + 1;
+    } else {
+      high = mid;
     }
   }
+
+  return (low < _entries && _read(low * ENTRY_SIZE, 8) == key) ? low : _entries;
 }
 
 bool Book::inBook(const Board &board) const {
-  return _content.find(hashBoard(board)) != _content.end();
+  return _findFirst(hashBoard(board)) != _entries;
 }
 
 Move Book::getMove(const Board &board) const {
-  auto lookup = _content.find(hashBoard(board));
-  if (lookup != _content.end()) {
+  U64 key = hashBoard(board);
+  size_t first = _findFirst(key);
+  if (first != _entries) {
     // Pick move based on weighted random choice
+    size_t last = first;
     int weightSum = 0;
-    for (auto moveWeightPair : lookup->second) weightSum += moveWeightPair.second;
+    for (; last < _entries && _read(last * ENTRY_SIZE, 8) == key; last++) {
+      weightSum += _read(last * ENTRY_SIZE + 10, 2);
+    }
 
     std::random_device rd;
     std::mt19937_64 mt(rd());
     std::uniform_int_distribution<int> dist(0, weightSum);
     int randomTarget = dist(mt);
 
-    for (auto moveWeightPair : lookup->second) {
-      weightSum -= moveWeightPair.second;
+    for (size_t i = first; i < last; i++) {
+      weightSum -= _read(i * ENTRY_SIZE + 10, 2);
       if (weightSum <= randomTarget) {
-        return decodeMove(board, moveWeightPair.first);
+        return decodeMove(board, _read(i * ENTRY_SIZE + 8, 2));
       }
     }
     fatal("Error in calculating weighted average");
@@ -299,30 +326,10 @@ Move Book::getMove(const Board &board) const {
 }
 
 U64 Book::hashBoard(const Board &board) {
-  U64 hash = ZERO;
-
-  // Pieces
-  int pieceNum = 0;
-  for (PieceType pieceType : {PAWN, KNIGHT, BISHOP, ROOK, QUEEN, KING}) {
-    for (Color color : {BLACK, WHITE}) {
-      U64 pieces = board.getPieces(color, pieceType);
-
-      while (pieces) {
-        hash ^= RANDOM_PIECE[64 * pieceNum + _popLsb(pieces)];
-      }
-
-      pieceNum++;
-    }
-  }
-
   // Castles
-  // Book expected to be used for classical chess only
-  U64 castles = board.getCastlingRights();
-
-  hash = (castles & (ONE << h1)) ? hash ^ RANDOM_CASTLE[0] : hash;
-  hash = (castles & (ONE << a1)) ? hash ^ RANDOM_CASTLE[1] : hash;
-  hash = (castles & (ONE << h8)) ? hash ^ RANDOM_CASTLE[2] : hash;
-  hash = (castles & (ONE << a8)) ? hash ^ RANDOM_CASTLE[3] : hash;
+  // Book expected to be used for classical chess only,
+  // so board key has PolyGlot castling values
+  U64 hash = board.getZKey().getValue();
 
   // Enpassant
   if (board.getEnPassant() != ZERO) {
@@ -335,16 +342,13 @@ U64 Book::hashBoard(const Board &board) {
       possibleCapturingPawns = ((board.getEnPassant() << 7) & ~FILE_A) | ((board.getEnPassant() << 9) & ~FILE_H);
     }
 
-    // Add to hash only if an en passant capture is possible
-    if (possibleCapturingPawns & board.getPieces(board.getActivePlayer(), PAWN)) {
+    // Board key always has en passant file, PolyGlot only if an en passant capture is possible
+    if (!(possibleCapturingPawns & board.getPieces(board.getActivePlayer(), PAWN))) {
       int enPassantFile = _bitscanForward(board.getEnPassant()) % 8;
       hash ^= RANDOM_ENPASSANT[enPassantFile];
     }
   }
 
-  // Turn
-  hash = board.getActivePlayer() == WHITE ? hash ^ RANDOM_TURN : hash;
-
   return hash;
 }
 
@@ -21,14 +21,15 @@
 #include "defs.h"
 #include "move.h"
 #include "board.h"
-#include <vector>
-#include <unordered_map>
+#include <memory>
 
 /**
  * @brief Represents an opening book
  *
  * Opening books are constructed with a path to a file containing PolyGlot
- * book data, and load all moves into memory.
+ * book data. The file is memory mapped as is, PolyGlot entries are sorted
+ * by key, so positions are found by binary search without any parse step.
+ * Copies of a Book share the same mapping.
  */
 class Book {
  public:
@@ -72,6 +73,10 @@ class Book {
   /**
    * @brief Returns the 64 bit PolyGlot hash of the given board
    *
+   * ZKey uses PolyGlot random values, so the hash is taken from the
+   * incrementally updated key of the board. The only difference is en passant:
+   * PolyGlot hashes it only if en passant capture is possible.
+   *
    * @param board Board to calculate PolyGlot hash of
    * @return The PolyGlot hash of the given board
    */
@@ -87,9 +92,12 @@ class Book {
    */
   static Move decodeMove(const Board &, unsigned short);
 
- private:
   /**
-   * @brief Values used to calculate PolyGlot hashes
+   * @brief Values used to calculate PolyGlot hashes, also used by ZKey
+   *
+   * RANDOM_PIECE is indexed by 64 * kind + square, where kind is
+   * 2 * piece + (color == WHITE), pieces in order pawn, knight, bishop, rook, queen, king.
+   * RANDOM_CASTLE is in order: white short, white long, black short, black long.
    *
    * @{
    */
@@ -99,22 +107,45 @@ class Book {
   static const U64 RANDOM_TURN;
   /**@}*/
 
+ private:
   /**
-   * @brief Mapping of PolyGlot hashes to moves
+   * @brief Size of one PolyGlot entry in bytes
    *
-   * Each move is stored as a pair of 16 bit values, the first being the move
-   * (in PolyGlot form), and the second being the weight assigned to the move
-   * in the book.
+   * Entry is key (8 bytes), move (2), weight (2) and learn (4),
+   * all stored high byte first.
    */
-  std::unordered_map<U64, std::vector<std::pair<unsigned short, unsigned short>>> _content;
+  static const size_t ENTRY_SIZE = 16;
 
   /**
-   * @brief Reads all moves from the PolyGlot book file at the given path and
-   * loads them into this book
+   * @brief Memory mapped content of the book file
+   */
+  std::shared_ptr<const unsigned char> _data;
+
+  /**
+   * @brief Number of entries in the book file
+   */
+  size_t _entries;
+
+  /**
+   * @brief Maps the PolyGlot book file at the given path
    *
    * @param path Path to PolyGlot book file
    */
   void _initMoves(std::string);
+
+  /**
+   * @brief Returns index of the first entry with the given key,
+   * or _entries if key is not in the book
+   *
+   * @param key PolyGlot hash to search for
+   */
+  size_t _findFirst(U64) const;
+
+  /**
+   * @brief Reads big endian number of the given size (in bytes)
+   * at the given offset of the book file
+   */
+  U64 _read(size_t, int) const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "cmdargs.h"
+#include <algorithm>
+#include <cstdlib>
+
+CmdArgs::CmdArgs(int argCount, char* argValue[], int first,
+                 const std::vector<std::string> &keywords, const std::vector<std::string> &flags){
+  for (int i = first; i < argCount; i++){
+    std::string arg = argValue[i];
+    if (std::find(flags.begin(), flags.end(), arg) != flags.end()){
+      _values[arg] = "";
+    }else if (std::find(keywords.begin(), keywords.end(), arg) != keywords.end()){
+      // keyword without a value at the end is ignored
+      if (i + 1 < argCount) _values[arg] = argValue[++i];
+    }else{
+      _positional.push_back(arg);
+    }
+  }
+}
+
+bool CmdArgs::has(const std::string &key) const {
+  return _values.count(key) != 0;
+}
+
+std::string CmdArgs::get(const std::string &key, const std::string &defaultValue) const {
+  auto it = _values.find(key);
+  return it == _values.end() ? defaultValue : it->second;
+}
+
+int CmdArgs::getInt(const std::string &key, int defaultValue) const {
+  return has(key) ? atoi(get(key, "").c_str()) : defaultValue;
+}
+
+U64 CmdArgs::getU64(const std::string &key, U64 defaultValue) const {
+  return has(key) ? strtoull(get(key, "").c_str(), nullptr, 10) : defaultValue;
+}
+
+float CmdArgs::getFloat(const std::string &key, float defaultValue) const {
+  return has(key) ? atof(get(key, "").c_str()) : defaultValue;
+}
+
+std::string CmdArgs::positional(size_t index, const std::string &defaultValue) const {
+  return index < _positional.size() ? _positional[index] : defaultValue;
+}
+
+int CmdArgs::positionalInt(size_t index, int defaultValue) const {
+  return index < _positional.size() ? atoi(_positional[index].c_str()) : defaultValue;
+}
+
+U64 CmdArgs::positionalU64(size_t index, U64 defaultValue) const {
+  return index < _positional.size() ? strtoull(_positional[index].c_str(), nullptr, 10) : defaultValue;
+}
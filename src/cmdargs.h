@@ -0,0 +1,75 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef CMDARGS_H
+#define CMDARGS_H
+
+#include "defs.h"
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Arguments of a command line mode: positional values with
+ * keywords anywhere between them, e.g. "analyze wac.epd 4 64 depth 12".
+ *
+ * Keywords are either followed by a value or are flags without one.
+ * Other arguments are positional, taken in order of appearance.
+ */
+class CmdArgs {
+ public:
+  /**
+   * @brief Parses arguments of main()
+   *
+   * @param argCount Number of arguments
+   * @param argValue Arguments
+   * @param first Index of the first argument of the mode
+   * @param keywords Keywords followed by a value
+   * @param flags Keywords without a value
+   */
+  CmdArgs(int, char* [], int, const std::vector<std::string> &, const std::vector<std::string> & = {});
+
+  /**
+   * @brief Returns true if the keyword or the flag is given
+   */
+  bool has(const std::string &) const;
+
+  /**
+   * @brief Returns value of the keyword or the default value if it is not given
+   * @{
+   */
+  std::string get(const std::string &, const std::string &) const;
+  int         getInt(const std::string &, int) const;
+  U64         getU64(const std::string &, U64) const;
+  float       getFloat(const std::string &, float) const;
+  /**@}*/
+
+  /**
+   * @brief Returns positional argument by its index or the default value if there is none
+   * @{
+   */
+  std::string positional(size_t, const std::string &) const;
+  int         positionalInt(size_t, int) const;
+  U64         positionalU64(size_t, U64) const;
+  /**@}*/
+
+ private:
+  std::map<std::string, std::string> _values;
+  std::vector<std::string> _positional;
+};
+
+#endif
@@ -0,0 +1,331 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "datagen.h"
+#include "packedpos.h"
+#include "searchworker.h"
+#include "cmdargs.h"
+#include "movegen.h"
+#include "timer.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <random>
+
+// Games with unbalanced random openings are not played
+const int DATAGEN_OPENING_SCORE = 1000;
+
+// Adjudication: win after WIN_PLIES plies with score above WIN_SCORE,
+// draw after DRAW_PLIES plies with score within DRAW_SCORE
+const int DATAGEN_WIN_SCORE   = 2000;
+const int DATAGEN_WIN_PLIES   = 4;
+const int DATAGEN_DRAW_SCORE  = 10;
+const int DATAGEN_DRAW_PLIES  = 8;
+const int DATAGEN_DRAW_START  = 80;
+
+namespace {
+
+struct DatagenSettings {
+    int         threads;
+    U64         positions;
+    std::string file;
+    Limits      limits;
+    int         randomPlies;
+    int         hashSize;
+    U64         seed;
+    bool        chains;
+
+    DatagenSettings() : threads(1), positions(DATAGEN_POSITIONS), file("data.bin"),
+                        randomPlies(DATAGEN_RANDOM_PLIES), hashSize(16), seed(0), chains(false) {};
+};
+
+MoveList legalMoves(const Board &board){
+    MoveList moves, legal;
+    MoveGen(&board, false, &moves);
+
+    for (auto &move : moves){
+        Board movedBoard = board;
+        if (movedBoard.doMove(move)) legal.push_back(move);
+    }
+    return legal;
+}
+
+void addToHistory(Hist &history, const Board &board, Move move){
+    if (move.getPieceType() == PAWN || (move.getFlags() & Move::CAPTURE)){
+        history = Hist();
+    }
+    history.Add(board.getZKey().getValue());
+}
+
+bool isRepetition(const Hist &history, U64 key){
+    int count = 0;
+    for (int i = 0; i < history.head; i++){
+        count += history.hisKey[i] == key;
+    }
+    return count >= 3;
+}
+
+// No pieces, or a single minor piece
+bool isInsufficientMaterial(const Board &board){
+    U64 pieces = board.getMaterialKey() >> MATERIAL_COUNT_SHIFT;
+    U64 minors = board.getPieces(WHITE, KNIGHT) | board.getPieces(WHITE, BISHOP) |
+                 board.getPieces(BLACK, KNIGHT) | board.getPieces(BLACK, BISHOP);
+    return pieces == 0 || (pieces == 1 && minors);
+}
+
+// Plays random opening, returns false if the game ended during it
+bool playOpening(Board &board, Hist &history, int plies, std::mt19937_64 &rng){
+    for (int ply = 0; ply < plies; ply++){
+        MoveList moves = legalMoves(board);
+        if (moves.empty()) return false;
+
+        Move move = moves[rng() % moves.size()];
+        board.doMove(move);
+        addToHistory(history, board, move);
+    }
+    return !legalMoves(board).empty();
+}
+
+// Plays one game, all its positions are added to the positions,
+// the ones that are not quiet are marked with PACKED_SKIP
+// Returns false if the game was discarded
+bool playGame(SearchWorker &worker, const DatagenSettings &settings,
+              std::mt19937_64 &rng, std::vector<PackedPos> &positions){
+    Board board = Board();
+    Hist history = Hist();
+
+    positions.clear();
+    worker.clear();
+
+    if (!playOpening(board, history, settings.randomPlies, rng)) return false;
+
+    GameResult result = RESULT_DRAW;
+    int winPlies = 0, drawPlies = 0;
+
+    for (int ply = 0; ply < DATAGEN_MAX_PLIES; ply++){
+        Search &search = worker.setPosition(board, settings.limits, history);
+        search.iterDeep();
+
+        Move move = search.getBestMove();
+
+        // Node limit may stop the search inside depth 1, it is finished
+        // without the limit then: every packed position needs a move
+        if (move.getFlags() & Move::NULL_MOVE){
+            Limits depthOne;
+            depthOne.depth = 1;
+            worker.setPosition(board, depthOne, history).iterDeep();
+            move = search.getBestMove();
+        }
+
+        int score = search.getBestScore();
+        Color stm = board.getActivePlayer();
+
+        if (ply == 0 && abs(score) > DATAGEN_OPENING_SCORE) return false;
+
+        positions.push_back(Packed::pack(board, score, move));
+        if (board.colorIsInCheck(stm) || !move.isQuiet()){
+            positions.back().flags |= PACKED_SKIP;
+        }
+
+        // Adjudication by score
+        winPlies  = abs(score) >= DATAGEN_WIN_SCORE ? winPlies + 1 : 0;
+        drawPlies = abs(score) <= DATAGEN_DRAW_SCORE ? drawPlies + 1 : 0;
+        if (winPlies >= DATAGEN_WIN_PLIES){
+            result = (score > 0) == (stm == WHITE) ? RESULT_WHITE_WIN : RESULT_BLACK_WIN;
+            break;
+        }
+        if (ply >= DATAGEN_DRAW_START && drawPlies >= DATAGEN_DRAW_PLIES) break;
+
+        board.doMove(move);
+        addToHistory(history, board, move);
+
+        // Game is over by the rules
+        if (legalMoves(board).empty()){
+            if (board.colorIsInCheck(board.getActivePlayer())){
+                result = stm == WHITE ? RESULT_WHITE_WIN : RESULT_BLACK_WIN;
+            }
+            break;
+        }
+        if (board.getHalfmoveClock() >= 100 || isRepetition(history, board.getZKey().getValue()) ||
+            isInsufficientMaterial(board)){
+            break;
+        }
+    }
+
+    for (auto &pos : positions){
+        Packed::setResult(pos, result);
+    }
+    return true;
+}
+
+}
+
+void datagen(int argCount, char* argValue[]){
+    DatagenSettings settings;
+
+    // positional: threads, positions, file; keywords with values anywhere
+    CmdArgs args(argCount, argValue, 2, {"nodes", "depth", "random", "hash", "seed"}, {"chain"});
+    settings.threads     = args.positionalInt(0, settings.threads);
+    settings.positions   = args.positionalU64(1, settings.positions);
+    settings.file        = args.positional(2, settings.file);
+    settings.randomPlies = args.getInt("random", settings.randomPlies);
+    settings.hashSize    = args.getInt("hash", settings.hashSize);
+    settings.seed        = args.getU64("seed", settings.seed);
+    settings.chains      = args.has("chain");
+
+    // default node limit is not used with a depth limit
+    settings.limits.depth = args.getInt("depth", 0);
+    settings.limits.nodes = args.getU64("nodes", settings.limits.depth ? 0 : DATAGEN_NODES);
+
+    settings.threads  = std::max(MIN_THREADS, std::min(settings.threads, MAX_THREADS));
+    settings.hashSize = std::max(MIN_HASH, std::min(settings.hashSize, MAX_HASH));
+    settings.limits.depth = std::max(0, std::min(settings.limits.depth, MAX_SEARCH_DEPTH));
+
+    PackedWriter writer;
+    writer.open(settings.file, true, settings.chains);
+    // the target counts only quiet positions, chains hold skipped ones too
+    U64 initialCount = writer.quietCount();
+
+    std::cout << "Datagen: " << settings.threads << " threads, " << initialCount << " of "
+              << settings.positions << " positions in " << settings.file << ", "
+              << (settings.limits.depth ? "depth " + std::to_string(settings.limits.depth) : "")
+              << (settings.limits.depth && settings.limits.nodes ? ", " : "")
+              << (settings.limits.nodes ? "nodes " + std::to_string(settings.limits.nodes) : "")
+              << std::endl;
+
+    std::mutex writerMutex;
+    std::atomic<U64> games(0);
+    std::atomic<bool> done(initialCount >= settings.positions);
+
+    auto runWorker = [&](int t){
+        // resumed generation must not repeat games of the previous run
+        std::mt19937_64 rng(settings.seed * MAX_THREADS + t + initialCount * 0x9E3779B97F4A7C15ULL);
+        SearchWorker worker(t, settings.hashSize);
+        std::vector<PackedPos> positions, quiet;
+
+        while (!done){
+            if (!playGame(worker, settings, rng, positions)) continue;
+
+            std::lock_guard<std::mutex> lock(writerMutex);
+            if (done) break;
+            if (settings.chains){
+                writer.writeChain(positions);
+            }else{
+                quiet.clear();
+                for (auto &pos : positions){
+                    if (!(pos.flags & PACKED_SKIP)) quiet.push_back(pos);
+                }
+                U64 left = settings.positions - writer.quietCount();
+                writer.write(quiet.data(), std::min((U64) quiet.size(), left));
+            }
+            games++;
+            if (writer.quietCount() >= settings.positions) done = true;
+        }
+    };
+
+    std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < settings.threads; t++){
+        workers.push_back(std::thread(runWorker, t));
+    }
+
+    // progress report every 10 seconds
+    int lastReport = 0;
+    while (!done){
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        int elapsed = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed < lastReport + 10 || done) continue;
+        lastReport = elapsed;
+
+        std::lock_guard<std::mutex> lock(writerMutex);
+        U64 generated = writer.quietCount() - initialCount;
+        printf("Positions: %12llu  Games: %9llu  Positions/hour: %12llu\n",
+               writer.quietCount(), (U64) games, 3600 * generated / elapsed);
+        std::cout << std::flush;
+    }
+
+    for (auto &w : workers){
+        w.join();
+    }
+    writer.close();
+
+    int elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    printf("Done: %llu positions, %llu games in %d ms\n", writer.quietCount() - initialCount, (U64) games, elapsed);
+    std::cout << std::flush;
+}
+
+void packPositions(int argCount, char* argValue[]){
+    if (argCount < 4){
+        std::cout << "Usage: pack <text file> <packed file>" << std::endl;
+        return;
+    }
+
+    std::ifstream input(argValue[2]);
+    if (!input){
+        fatal("Failed to open " + std::string(argValue[2]));
+    }
+
+    PackedWriter writer;
+    writer.open(argValue[3], false);
+
+    std::string line;
+    U64 skipped = 0;
+    PackedPos pos;
+    while (std::getline(input, line)){
+        if (Packed::fromText(line, pos)){
+            writer.write(&pos, 1);
+        }else{
+            skipped++;
+        }
+    }
+    writer.close();
+
+    printf("Packed %llu positions, skipped %llu lines\n", writer.count(), skipped);
+    std::cout << std::flush;
+}
+
+void unpackPositions(int argCount, char* argValue[]){
+    if (argCount < 4){
+        std::cout << "Usage: unpack <packed file> <text file> [chain]" << std::endl;
+        return;
+    }
+    bool chains = argCount > 4 && std::string(argValue[4]) == "chain";
+
+    PackedReader reader;
+    reader.open(argValue[2]);
+
+    std::ofstream output(argValue[3]);
+    if (!output){
+        fatal("Failed to open " + std::string(argValue[3]));
+    }
+
+    U64 count = 0;
+    std::vector<PackedPos> positions(1);
+    while (chains ? reader.readChain(positions) : reader.read(positions[0])){
+        for (auto &pos : positions){
+            if (pos.flags & PACKED_SKIP) continue;
+            output << Packed::toText(pos) << "\n";
+            count++;
+        }
+    }
+
+    printf("Unpacked %llu positions\n", count);
+    std::cout << std::flush;
+}
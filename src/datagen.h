@@ -0,0 +1,66 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef DATAGEN_H
+#define DATAGEN_H
+
+#define DATAGEN_POSITIONS       (1000000)
+#define DATAGEN_NODES           (5000)
+#define DATAGEN_RANDOM_PLIES    (8)
+#define DATAGEN_MAX_PLIES       (400)
+
+/**
+ * @brief Generates training positions by self-play
+ *
+ * Command line: datagen [threads] [positions] [file] [nodes N] [depth N] [random N] [hash N] [seed N] [chain]
+ *
+ * Every thread plays its own games with its own Search and TT.
+ * Games start with "random" random plies, then every move is searched
+ * with the given node and depth limits, DATAGEN_NODES nodes if neither
+ * is given. Quiet positions (no check, best move is not a capture or
+ * promotion) are saved with
+ * the search score and the game result in packed format (see PackedPos).
+ * With "chain" whole games are saved as chains (see Packed), positions
+ * that are not quiet are marked with PACKED_SKIP.
+ * The requested number of positions counts only quiet positions, the
+ * ones used for training, in both formats; a chain file also holds the
+ * skipped ones. Positions are appended to the file, so generation stopped
+ * earlier continues until the file has the requested number of positions.
+ */
+void datagen(int, char* []);
+
+/**
+ * @brief Converts text positions to packed format
+ *
+ * Command line: pack <text file> <packed file>
+ *
+ * Text lines are "<FEN> | <score> | <result>" (see Packed),
+ * lines that can not be parsed are skipped.
+ */
+void packPositions(int, char* []);
+
+/**
+ * @brief Converts packed positions to text
+ *
+ * Command line: unpack <packed file> <text file> [chain]
+ *
+ * With "chain" the input file consists of chains, positions marked
+ * with PACKED_SKIP are not written.
+ */
+void unpackPositions(int, char* []);
+
+#endif
@@ -41,6 +41,7 @@ typedef unsigned long long U64;
 #define MAX_THREADS (  256)
 #define MAX_PLY     (  127)
 #define MAX_INT_PLY (  128)
+#define MAX_MULTIPV (  256)
 
 /**
  * @name Rank bitboards
@@ -66,6 +67,7 @@ const U64 RANK_8 = 0xff00000000000000ull;
 const int LOST_SCORE = -30000;
 const int NOSCORE = 32666;
 const int WON_IN_X = 30000 - MAX_INT_PLY;
+const int TB_WIN_SCORE = WON_IN_X - MAX_INT_PLY;   // tablebase wins, below any mate score
 const int MAX_GAME_PLY = 2048;
 
 /**
@@ -183,6 +185,32 @@ enum PieceType {
   KING
 };
 
+/**
+ * @brief Largest number of pieces (kings included) covered by special endgame evaluations
+ */
+#define LARGEST_SP_EVAL     (5)
+
+/**
+ * @brief First bit of the total piece count in a material key
+ */
+#define MATERIAL_COUNT_SHIFT (40)
+
+/**
+ * @brief Material key of a single piece.
+ *
+ * Material key is a sum over all pieces except kings: 4-bit count for every
+ * color and piece type and total piece count from MATERIAL_COUNT_SHIFT.
+ * Unlike Zobrist keys it is known at compile time.
+ */
+constexpr U64 materialKey(Color color, PieceType pieceType) {
+  return pieceType == KING ? 0 : (ONE << (4 * (5 * color + pieceType))) + (ONE << MATERIAL_COUNT_SHIFT);
+}
+
+/**
+ * @brief Material keys not less than this one have too many pieces for special endgame evaluations
+ */
+const U64 SP_EVAL_MATERIAL_LIMIT = U64(LARGEST_SP_EVAL - 1) << MATERIAL_COUNT_SHIFT;
+
 const int DEFAULT_SEARCH_DEPTH = 15;
 const int MAX_SEARCH_DEPTH = 64;
 const int PHASE_WEIGHT_SUM = 24;
@@ -21,8 +21,6 @@
 #include "movegen.h"
 #include "endgame.h"
 
-egEvalEntry myEvalHash [EG_HASH_SIZE];
-
 
 int Eval::evaluateDraw(const Board &board, Color color){
     return 0;
@@ -153,6 +151,13 @@ int Eval::evaluateKnights_vs_Pawn(const Board &board, Color color){
 int Eval::evaluateBishopPawn_vs_KP(const Board &board, Color color){
     int scale = 1;
 
+    // 0. KBPK is resolved by the bitbase if it is loaded,
+    // positions that are not won are scaled down to a draw
+    if (_popCount(board.getAllPieces(WHITE) | board.getAllPieces(BLACK)) == 4 && Bitbase::bitbase_loaded(Bitbase::BB_KBPK)){
+        Color bishopSide = board.getPieces(WHITE, BISHOP) ? WHITE : BLACK;
+        return Bitbase::bitbase_is_winning(Bitbase::BB_KBPK, board, bishopSide) ? 1 : 128;
+    }
+
     // 1. Galnce at PSQT, to see who is winning
     int psqt = board.getPSquareTable().getScore(color) - board.getPSquareTable().getScore(getOppositeColor(color));
     Color weak = egS(psqt) > 0 ? getOppositeColor(color) : color;
@@ -247,26 +252,37 @@ int Eval::evaluateRook_vs_Pawn(const Board &board, Color color){
     int strongKing = _bitscanForward(board.getPieces(strong, KING));
     int strongRook = _bitscanForward(board.getPieces(strong, ROOK));
 
+    // 1a. Bitbase (if it is loaded) knows if the rook side wins
+    if (Bitbase::bitbase_loaded(Bitbase::BB_KRKP) && board.getPieces(strong, ROOK)){
+        if (Bitbase::bitbase_is_winning(Bitbase::BB_KRKP, board, strong)){
+            s = MINIMAL_WON_SCORE + 8 - Eval::detail::DISTANCE[weakPawn][strongKing];
+        }else{
+            s = 20 - Eval::detail::DISTANCE[weakPawn][strongKing];
+        }
+    }
     // 2. If strong king is on the path of the pawn, it is always a win.
-    if (Eval::detail::PASSED_PAWN_MASKS[weak][weakPawn] & board.getPieces(strong, KING)){
+    else if (Eval::detail::PASSED_PAWN_MASKS[weak][weakPawn] & board.getPieces(strong, KING)){
         s = MINIMAL_WON_SCORE;
         // adjust it with king - pawn distance to ensure pawn will get captured
         s += 8 - Eval::detail::DISTANCE[weakPawn][strongKing];
-    }// 3. Position is also won when enemy king is far from own pawn and our rook (so it cant win a tempo)
+    }
+    // 3. Position is also won when enemy king is far from own pawn and our rook (so it cant win a tempo)
     else if ((Eval::detail::DISTANCE[weakPawn][weakKing] >= 3 + (weak == color)) &&
               Eval::detail::DISTANCE[strongRook][weakKing] >= 3){
         s = MINIMAL_WON_SCORE;
         // adjust it with king - pawn distance to ensure pawn will get captured
         s += 8 - Eval::detail::DISTANCE[weakPawn][strongKing];
-    } // 4. Draw case: strong king is far away AND behind, pawn is advanced,
-      // weak king is supporting it
+    }
+    // 4. Draw case: strong king is far away AND behind, pawn is advanced,
+    // weak king is supporting it
     else if (Eval::detail::DISTANCE[weakPawn][weakKing] == 1 &&
              (Eval::detail::DISTANCE[weakPawn][strongKing] > 2 + (strong == color)) &&
              _relrank(weakPawn, weak) > 3 &&
              _relrank(strongKing, weak) < _relrank(weakPawn, weak)){
 
         s = 20 - Eval::detail::DISTANCE[weakPawn][strongKing];
-    } // result is unclear, but likely to be drawish
+    }
+    // 5. Result is unclear, but likely to be drawish
     else {
         s = 100 - 8 * (Eval::detail::DISTANCE[strongKing][weakPawn] - // 1
                        Eval::detail::DISTANCE[weakKing][weakPawn] -   // 7
@@ -500,141 +516,198 @@ int Eval::evaluateKingPawn_vs_King(const Board &board, Color color){
     return s;
 }
 
-inline void Eval::egHashAdd(std::string psFen, egEvalFunction ef, egEntryType et){
-    ZKey key;
-    key.setpKeyFromString(psFen);
-    U64 index = key.getValue() & (EG_HASH_SIZE - 1);
-    if (myEvalHash[index].eFunction != nullptr){
-        std::cout << "error collision on " << psFen << std::endl;
-        exit(0);
-    }
-    myEvalHash[index] = egEvalEntry(key.getValue(), ef, et);
+int Eval::evaluateKingPawn_vs_KingPawn(const Board &board, Color color){
+    // Without bitbase NNUE eval is used as it is
+    if (!Bitbase::bitbase_loaded(Bitbase::BB_KPKP)) return 1;
+
+    // Positions won by none of the sides are scaled down to a draw
+    bool won = Bitbase::bitbase_is_winning(Bitbase::BB_KPKP, board, color) ||
+               Bitbase::bitbase_is_winning(Bitbase::BB_KPKP, board, getOppositeColor(color));
+
+    // as we only scaling existing eval, no need to reverse sign
+    return won ? 1 : 128;
 }
 
-void Eval::initEG(){
+namespace {
 
-    // initiate table with zero entries
-    for (int i = 0; i < EG_HASH_SIZE; i++){
-        myEvalHash[i] = egEvalEntry();
-    }
+// Special endgame evaluations are found by material key in a perfect hash
+// table, which is built at compile time from pseudo-FEN strings
+
+constexpr U64 egPieceKey(char piece){
+    return piece == 'P' ? materialKey(WHITE, PAWN)   : piece == 'p' ? materialKey(BLACK, PAWN)   :
+           piece == 'R' ? materialKey(WHITE, ROOK)   : piece == 'r' ? materialKey(BLACK, ROOK)   :
+           piece == 'N' ? materialKey(WHITE, KNIGHT) : piece == 'n' ? materialKey(BLACK, KNIGHT) :
+           piece == 'B' ? materialKey(WHITE, BISHOP) : piece == 'b' ? materialKey(BLACK, BISHOP) :
+           piece == 'Q' ? materialKey(WHITE, QUEEN)  : piece == 'q' ? materialKey(BLACK, QUEEN)  : 0;
+}
+
+constexpr U64 egKey(const char * psFen){
+    return *psFen ? egPieceKey(*psFen) + egKey(psFen + 1) : 0;
+}
+
+constexpr egEvalEntry egEntry(const char * psFen, egEvalFunction ef, egEntryType et){
+    return egEvalEntry(egKey(psFen), ef, et);
+}
 
+constexpr egEvalEntry EG_ENTRIES[] = {
     // Add some generic draws
     // 0. 2-man (KvsK) is draw
-    egHashAdd("k/K", &evaluateDraw, RETURN_SCORE);
+    egEntry("k/K", &Eval::evaluateDraw, RETURN_SCORE),
 
     // 3-man eval:
     // King vs King + Bishop = insufficient material
-    egHashAdd("kb/K", &evaluateDraw, RETURN_SCORE);
-    egHashAdd("k/KB", &evaluateDraw, RETURN_SCORE);
+    egEntry("kb/K", &Eval::evaluateDraw, RETURN_SCORE),
+    egEntry("k/KB", &Eval::evaluateDraw, RETURN_SCORE),
     // King vs King + Knight = insufficient material
-    egHashAdd("kn/K", &evaluateDraw, RETURN_SCORE);
-    egHashAdd("k/KN", &evaluateDraw, RETURN_SCORE);
+    egEntry("kn/K", &Eval::evaluateDraw, RETURN_SCORE),
+    egEntry("k/KN", &Eval::evaluateDraw, RETURN_SCORE),
     // King vs King + Rook   = win;
-    egHashAdd("kr/K", &evaluateQueen_vs_X, RETURN_SCORE);
-    egHashAdd("k/KR", &evaluateQueen_vs_X, RETURN_SCORE);
+    egEntry("kr/K", &Eval::evaluateQueen_vs_X, RETURN_SCORE),
+    egEntry("k/KR", &Eval::evaluateQueen_vs_X, RETURN_SCORE),
     // King vs King + Queen  = win
-    egHashAdd("kq/K", &evaluateQueen_vs_X, RETURN_SCORE);
-    egHashAdd("k/KQ", &evaluateQueen_vs_X, RETURN_SCORE);
+    egEntry("kq/K", &Eval::evaluateQueen_vs_X, RETURN_SCORE),
+    egEntry("k/KQ", &Eval::evaluateQueen_vs_X, RETURN_SCORE),
     // KPK is evaluated by bitbase (basically Stash code for Bitbase)
-    egHashAdd("kp/K", &evaluateKingPawn_vs_King, RETURN_SCORE);
-    egHashAdd("k/KP", &evaluateKingPawn_vs_King, RETURN_SCORE);
+    egEntry("kp/K", &Eval::evaluateKingPawn_vs_King, RETURN_SCORE),
+    egEntry("k/KP", &Eval::evaluateKingPawn_vs_King, RETURN_SCORE),
 
     // 4-man eval
     // Obviously KN vs KB etc is draw also
-    egHashAdd("kn/KN", &evaluateDraw, RETURN_SCORE);
-    egHashAdd("kb/KB", &evaluateDraw, RETURN_SCORE);
-    egHashAdd("kn/KB", &evaluateDraw, RETURN_SCORE);
-    egHashAdd("kb/KN", &evaluateDraw, RETURN_SCORE);
+    egEntry("kn/KN", &Eval::evaluateDraw, RETURN_SCORE),
+    egEntry("kb/KB", &Eval::evaluateDraw, RETURN_SCORE),
+    egEntry("kn/KB", &Eval::evaluateDraw, RETURN_SCORE),
+    egEntry("kb/KN", &Eval::evaluateDraw, RETURN_SCORE),
     // R vs R and Q vs Q is also a draw
-    egHashAdd("kr/KR", &evaluateDraw, RETURN_SCORE);
-    egHashAdd("kq/KQ", &evaluateDraw, RETURN_SCORE);
+    egEntry("kr/KR", &Eval::evaluateDraw, RETURN_SCORE),
+    egEntry("kq/KQ", &Eval::evaluateDraw, RETURN_SCORE),
     // King vs King + two knights is a draw
-    egHashAdd("k/KNN", &evaluateDraw, RETURN_SCORE);
-    egHashAdd("knn/K", &evaluateDraw, RETURN_SCORE);
+    egEntry("k/KNN", &Eval::evaluateDraw, RETURN_SCORE),
+    egEntry("knn/K", &Eval::evaluateDraw, RETURN_SCORE),
     // Trivial win for Q vs (R or B or N)
-    egHashAdd("kq/KB", &evaluateQueen_vs_X, RETURN_SCORE);
-    egHashAdd("kb/KQ", &evaluateQueen_vs_X, RETURN_SCORE);
-    egHashAdd("kq/KN", &evaluateQueen_vs_X, RETURN_SCORE);
-    egHashAdd("kn/KQ", &evaluateQueen_vs_X, RETURN_SCORE);
-    egHashAdd("kq/KR", &evaluateQueen_vs_X, RETURN_SCORE);
-    egHashAdd("kr/KQ", &evaluateQueen_vs_X, RETURN_SCORE);
+    egEntry("kq/KB", &Eval::evaluateQueen_vs_X, RETURN_SCORE),
+    egEntry("kb/KQ", &Eval::evaluateQueen_vs_X, RETURN_SCORE),
+    egEntry("kq/KN", &Eval::evaluateQueen_vs_X, RETURN_SCORE),
+    egEntry("kn/KQ", &Eval::evaluateQueen_vs_X, RETURN_SCORE),
+    egEntry("kq/KR", &Eval::evaluateQueen_vs_X, RETURN_SCORE),
+    egEntry("kr/KQ", &Eval::evaluateQueen_vs_X, RETURN_SCORE),
     // Not so clear with Q vs P
-    egHashAdd("kq/KP", &evaluateQueen_vs_Pawn, RETURN_SCORE);
-    egHashAdd("kp/KQ", &evaluateQueen_vs_Pawn, RETURN_SCORE);
+    egEntry("kq/KP", &Eval::evaluateQueen_vs_Pawn, RETURN_SCORE),
+    egEntry("kp/KQ", &Eval::evaluateQueen_vs_Pawn, RETURN_SCORE),
     // Rook vs Minors
-    egHashAdd("kr/KN", &evaluateRook_vs_Knight, RETURN_SCORE);
-    egHashAdd("kn/KR", &evaluateRook_vs_Knight, RETURN_SCORE);
-    egHashAdd("kr/KB", &evaluateRook_vs_Bishop, RETURN_SCORE);
-    egHashAdd("kb/KR", &evaluateRook_vs_Bishop, RETURN_SCORE);
+    egEntry("kr/KN", &Eval::evaluateRook_vs_Knight, RETURN_SCORE),
+    egEntry("kn/KR", &Eval::evaluateRook_vs_Knight, RETURN_SCORE),
+    egEntry("kr/KB", &Eval::evaluateRook_vs_Bishop, RETURN_SCORE),
+    egEntry("kb/KR", &Eval::evaluateRook_vs_Bishop, RETURN_SCORE),
     // Rook vs Pawns
-    egHashAdd("kr/KP", &evaluateRook_vs_Pawn, RETURN_SCORE);
-    egHashAdd("kp/KR", &evaluateRook_vs_Pawn, RETURN_SCORE);
+    egEntry("kr/KP", &Eval::evaluateRook_vs_Pawn, RETURN_SCORE),
+    egEntry("kp/KR", &Eval::evaluateRook_vs_Pawn, RETURN_SCORE),
     // ToDo - > lone minor vs pawns scaling (in main eval)
 
     //Some easy wins with huge advantage
     /* So far causing bugs in some drawn pVs, so commend out
-    egHashAdd("kqq/K", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("k/KQQ", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("kqr/K", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("k/KQR", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("kqb/K", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("k/KQB", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("kqn/K", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("k/KQN", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("kqp/K", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("k/KQP", &evaluateHugeAdvantage, RETURN_SCORE);
-
-    egHashAdd("krr/K", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("k/KRR", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("krb/K", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("k/KRB", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("krn/K", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("k/KRN", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("krp/K", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("k/KRP", &evaluateHugeAdvantage, RETURN_SCORE);
-
-    egHashAdd("kbb/K", &evaluateHugeAdvantage, RETURN_SCORE);
-    egHashAdd("k/KBB", &evaluateHugeAdvantage, RETURN_SCORE);
+    egEntry("kqq/K", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("k/KQQ", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("kqr/K", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("k/KQR", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("kqb/K", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("k/KQB", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("kqn/K", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("k/KQN", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("kqp/K", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("k/KQP", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+
+    egEntry("krr/K", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("k/KRR", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("krb/K", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("k/KRB", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("krn/K", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("k/KRN", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("krp/K", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("k/KRP", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+
+    egEntry("kbb/K", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
+    egEntry("k/KBB", &Eval::evaluateHugeAdvantage, RETURN_SCORE),
     */
 
-    egHashAdd("kbn/K", &evaluateBN_Mating, RETURN_SCORE);
-    egHashAdd("k/KBN", &evaluateBN_Mating, RETURN_SCORE);
+    egEntry("kbn/K", &Eval::evaluateBN_Mating, RETURN_SCORE),
+    egEntry("k/KBN", &Eval::evaluateBN_Mating, RETURN_SCORE),
 
     // KBPvsK corner pawn
-    egHashAdd("kbp/K", &evaluateBishopPawn_vs_KP, RETURN_SCALE);
-    egHashAdd("k/KBP", &evaluateBishopPawn_vs_KP, RETURN_SCALE);
+    egEntry("kbp/K", &Eval::evaluateBishopPawn_vs_KP, RETURN_SCALE),
+    egEntry("k/KBP", &Eval::evaluateBishopPawn_vs_KP, RETURN_SCALE),
 
     // 5-man eval
     // lets say
     // King, Rook, Bishop vs King and Rook
-    egHashAdd("krb/KR", &evaluateRookMinor_Rook, RETURN_SCORE);
-    egHashAdd("kr/KRB", &evaluateRookMinor_Rook, RETURN_SCORE);
+    egEntry("krb/KR", &Eval::evaluateRookMinor_Rook, RETURN_SCORE),
+    egEntry("kr/KRB", &Eval::evaluateRookMinor_Rook, RETURN_SCORE),
     // King, Rook, Knight vs King and Rook
-    egHashAdd("krn/KR", &evaluateRookMinor_Rook, RETURN_SCORE);
-    egHashAdd("kr/KRN", &evaluateRookMinor_Rook, RETURN_SCORE);
+    egEntry("krn/KR", &Eval::evaluateRookMinor_Rook, RETURN_SCORE),
+    egEntry("kr/KRN", &Eval::evaluateRookMinor_Rook, RETURN_SCORE),
     // Obvious minors draws
-    egHashAdd("knn/KN", &evaluateDraw, RETURN_SCORE);
-    egHashAdd("kn/KNN", &evaluateDraw, RETURN_SCORE);
-    egHashAdd("kbb/KB", &evaluateDraw, RETURN_SCORE);
-    egHashAdd("kb/KBB", &evaluateDraw, RETURN_SCORE);
+    egEntry("knn/KN", &Eval::evaluateDraw, RETURN_SCORE),
+    egEntry("kn/KNN", &Eval::evaluateDraw, RETURN_SCORE),
+    egEntry("kbb/KB", &Eval::evaluateDraw, RETURN_SCORE),
+    egEntry("kb/KBB", &Eval::evaluateDraw, RETURN_SCORE),
     // Common endgames
-    egHashAdd("kbp/KB", &evaluateBishopPawn_vs_Bishop, RETURN_SCALE);
-    egHashAdd("kb/KBP", &evaluateBishopPawn_vs_Bishop, RETURN_SCALE);
-    egHashAdd("kbp/KN", &evaluateBishopPawn_vs_Knight, RETURN_SCALE);
-    egHashAdd("kn/KBP", &evaluateBishopPawn_vs_Knight, RETURN_SCALE);
+    egEntry("kbp/KB", &Eval::evaluateBishopPawn_vs_Bishop, RETURN_SCALE),
+    egEntry("kb/KBP", &Eval::evaluateBishopPawn_vs_Bishop, RETURN_SCALE),
+    egEntry("kbp/KN", &Eval::evaluateBishopPawn_vs_Knight, RETURN_SCALE),
+    egEntry("kn/KBP", &Eval::evaluateBishopPawn_vs_Knight, RETURN_SCALE),
     // Evaluate Q vs RP fortress
-    egHashAdd("krp/KQ", &evaluateQueen_vs_RookPawn, RETURN_SCALE);
-    egHashAdd("kq/KRP", &evaluateQueen_vs_RookPawn, RETURN_SCALE);
+    egEntry("krp/KQ", &Eval::evaluateQueen_vs_RookPawn, RETURN_SCALE),
+    egEntry("kq/KRP", &Eval::evaluateQueen_vs_RookPawn, RETURN_SCALE),
     // Evaluate RP vs B fortress
-    egHashAdd("krp/KB", &evaluateRookPawn_vs_Bishop, RETURN_SCALE);
-    egHashAdd("kb/KRP", &evaluateRookPawn_vs_Bishop, RETURN_SCALE);
+    egEntry("krp/KB", &Eval::evaluateRookPawn_vs_Bishop, RETURN_SCALE),
+    egEntry("kb/KRP", &Eval::evaluateRookPawn_vs_Bishop, RETURN_SCALE),
     // Evaluate NN vs P winning chances
-    egHashAdd("knn/KP", &evaluateKnights_vs_Pawn, RETURN_SCORE);
-    egHashAdd("kp/KNN", &evaluateKnights_vs_Pawn, RETURN_SCORE);
+    egEntry("knn/KP", &Eval::evaluateKnights_vs_Pawn, RETURN_SCORE),
+    egEntry("kp/KNN", &Eval::evaluateKnights_vs_Pawn, RETURN_SCORE),
     // Evaluate RP vs R endgames
-    egHashAdd("krp/KR", &evaluateRookPawn_vs_Rook, RETURN_SCALE);
-    egHashAdd("kr/KRP", &evaluateRookPawn_vs_Rook, RETURN_SCALE);
+    egEntry("krp/KR", &Eval::evaluateRookPawn_vs_Rook, RETURN_SCALE),
+    egEntry("kr/KRP", &Eval::evaluateRookPawn_vs_Rook, RETURN_SCALE),
+    // KPKP is scaled by bitbase, if it is loaded
+    egEntry("kp/KP", &Eval::evaluateKingPawn_vs_KingPawn, RETURN_SCALE),
     //Some KBPvsKP
-    egHashAdd("kbp/KP", &evaluateBishopPawn_vs_KP, RETURN_SCALE);
-    egHashAdd("kp/KBP", &evaluateBishopPawn_vs_KP, RETURN_SCALE);
-}
\ No newline at end of file
+    egEntry("kbp/KP", &Eval::evaluateBishopPawn_vs_KP, RETURN_SCALE),
+    egEntry("kp/KBP", &Eval::evaluateBishopPawn_vs_KP, RETURN_SCALE)
+};
+
+constexpr int EG_ENTRIES_NUMBER = sizeof(EG_ENTRIES) / sizeof(egEvalEntry);
+
+// Every entry must have its own slot...
+constexpr bool egSlotFree(int i, int j){
+    return j == EG_ENTRIES_NUMBER ||
+           (egHashSlot(EG_ENTRIES[i].key) != egHashSlot(EG_ENTRIES[j].key) && egSlotFree(i, j + 1));
+}
+
+constexpr bool egPerfectHash(int i){
+    return i == EG_ENTRIES_NUMBER || (egSlotFree(i, i + 1) && egPerfectHash(i + 1));
+}
+
+static_assert(egPerfectHash(0), "Special endgame entries collide, EG_HASH_MULT should be changed");
+
+// ...and not more pieces than Board::isSpEvalCandidate() lets through
+constexpr bool egSmallMaterial(int i){
+    return i == EG_ENTRIES_NUMBER || (EG_ENTRIES[i].key < SP_EVAL_MATERIAL_LIMIT && egSmallMaterial(i + 1));
+}
+
+static_assert(egSmallMaterial(0), "Special endgame entry has more than LARGEST_SP_EVAL pieces");
+
+constexpr egEvalEntry egFind(int slot, int i){
+    return i == EG_ENTRIES_NUMBER ? egEvalEntry() :
+           egHashSlot(EG_ENTRIES[i].key) == slot ? EG_ENTRIES[i] : egFind(slot, i + 1);
+}
+
+template<int... Slots> struct egSlots {};
+template<int N, int... Slots> struct egMakeSlots : egMakeSlots<N - 1, N - 1, Slots...> {};
+template<int... Slots> struct egMakeSlots<0, Slots...> { typedef egSlots<Slots...> type; };
+
+template<int... Slots>
+constexpr egEvalTable egBuildTable(egSlots<Slots...>){
+    return egEvalTable{{ egFind(Slots, 0)... }};
+}
+
+}
+
+const egEvalTable myEvalHash = egBuildTable(egMakeSlots<EG_HASH_SIZE>::type());
@@ -22,10 +22,12 @@
 #include "board.h"
 #include "bitutils.h"
 #include <cstdint>
+#include <string>
+#include <vector>
 
 
-#define EG_HASH_SIZE        (8192)
-#define LARGEST_SP_EVAL     (5)
+#define EG_HASH_BITS        (8)
+#define EG_HASH_SIZE        (1 << EG_HASH_BITS)
 #define KPK_SIZE            (2 * 24 * 64 * 64)
 #define KPK_INVALID         (0)
 #define KPK_UNKNOWN         (1)
@@ -45,10 +47,32 @@ struct egEvalEntry{
     egEvalFunction eFunction;
     egEntryType    evalType;
 
-    egEvalEntry(): key(0), eFunction(nullptr), evalType(RETURN_SCALE)  {};
-    egEvalEntry(U64 k, egEvalFunction ef, egEntryType et): key(k), eFunction(ef), evalType(et) {};
+    constexpr egEvalEntry(): key(0), eFunction(nullptr), evalType(RETURN_SCALE)  {};
+    constexpr egEvalEntry(U64 k, egEvalFunction ef, egEntryType et): key(k), eFunction(ef), evalType(et) {};
 };
 
+struct egEvalTable{
+    egEvalEntry entries[EG_HASH_SIZE];
+};
+
+/**
+ * @brief Multiplier of the special endgame hash, chosen so that
+ * all entries of the table get different slots.
+ */
+const U64 EG_HASH_MULT = 0x21615022409a8a79ULL;
+
+/**
+ * @brief Returns slot of the special endgame table for the given material key
+ */
+constexpr int egHashSlot(U64 materialKey){
+    return (materialKey * EG_HASH_MULT) >> (64 - EG_HASH_BITS);
+}
+
+/**
+ * @brief Special endgame evaluations by material key, built at compile time
+ */
+extern const egEvalTable myEvalHash;
+
 struct kpk_position{
     Color   stm;
     int     kingSq[2];
@@ -87,9 +111,92 @@ bool kpk_is_winning(Color, int, int, int);
 
 void kpk_set(kpk_position*, unsigned int);
 void kpk_classify(kpk_position *, kpk_position *);
+
+/**
+ * @brief Builds KPK bitbase by retrograde analysis
+ *
+ * @param bitbase Array of KPK_SIZE / 8 bytes to fill, bit is set for won positions
+ */
+void generate_kpk(uint8_t *);
+
+/**
+ * @brief Checks embedded KPK bitbase against the generator (only in _KPK_CHECK_ builds)
+ */
 void init_kpk();
 
 int eval_by_kpk(const Board &, Color);
+
+/**
+ * @brief 4-man endgames covered by generated bitbases
+ */
+enum egBitbase {
+    BB_KPKP,
+    BB_KRKP,
+    BB_KBPK,
+    BB_NUMBER
+};
+
+/**
+ * @brief Material of a bitbase endgame besides the kings: leading pawn
+ * and the fourth piece, WHITE is the strong side
+ */
+struct egBitbaseSpec {
+    const char * name;
+    Color        color[2];
+    PieceType    type[2];
+};
+
+extern const egBitbaseSpec EG_BITBASE_SPECS[BB_NUMBER];
+
+/**
+ * @brief Number of positions in a bitbase:
+ * side to move, strong king, weak king, leading pawn (files a-d) and fourth piece
+ */
+const unsigned int EG_BITBASE_SIZE = 2 * 64 * 64 * 24 * 64;
+
+/**
+ * @brief Returns bitbase index of the position
+ *
+ * @param stm Side to move, WHITE is the strong side
+ * @param squares Strong king, weak king, leading pawn and fourth piece
+ */
+unsigned int bitbase_index(Color, const int *);
+
+/**
+ * @brief Loads bitbases of 4-man endgames from the given directory.
+ *
+ * Bitbases are generated by "make bbgen" (tools/bbgen.cc), missing ones
+ * are reported and not used. Empty path or "<empty>" unloads all bitbases.
+ *
+ * @param path Directory with bitbase files
+ */
+void init_bitbases(const std::string &);
+
+/**
+ * @brief Saves bitbase to the given directory, used by the generator
+ *
+ * @param bb Endgame
+ * @param path Directory for bitbase files
+ * @param data EG_BITBASE_SIZE / 8 bytes, bit is set if strong side wins
+ * @return false if the file could not be written
+ */
+bool save_bitbase(egBitbase, const std::string &, const std::vector<uint8_t> &);
+
+/**
+ * @brief Returns true if bitbase of the endgame is loaded
+ */
+bool bitbase_loaded(egBitbase);
+
+/**
+ * @brief Probes bitbase of the endgame, should be called only if it is loaded
+ *
+ * @param bb Endgame of the board
+ * @param board Position to probe
+ * @param strong Side to check win for: side with the rook in KRKP,
+ * with the bishop in KBPK, any side in KPKP
+ * @return True if strong side wins
+ */
+bool bitbase_is_winning(egBitbase, const Board &, Color);
 }
 
 
@@ -23,8 +23,6 @@
 #include "eval.h"
 #include "transptable.h"
 
-extern egEvalEntry myEvalHash[];
-
 U64 Eval::detail::FILES[8] = {FILE_A, FILE_B, FILE_C, FILE_D, FILE_E, FILE_F, FILE_G, FILE_H};
 U64 Eval::detail::DISTANCE[64][64];
 
@@ -36,7 +34,6 @@ U64 Eval::detail::IN_BETWEEN[64][64];
 
 
 void Eval::init() {
-  initEG();
   // Initialize passed pawn masks
   for (int square = 0; square < 64; square++) {
 
@@ -69,23 +66,26 @@ void Eval::init() {
     }
   }
 
-  // Init KPK bitbase
-  // It should be initialized after rest of the Eval as some const are used in the
+  // Check KPK bitbase
+  // It should be done after rest of the Eval as some const are used in the
   // bitbase creation
   Bitbase::init_kpk();
 }
 
 int Eval::evaluate(const Board &board, Color color){
 
-    // Probe eval hash
-    U64 index = board.getpCountKey().getValue() & (EG_HASH_SIZE - 1);
-    egEvalFunction spEval   = myEvalHash[index].eFunction;
-    egEntryType    spevType = myEvalHash[index].evalType;
-    int            egResult = 1;
+    // Probe eval hash, only positions with few pieces can have
+    // special endgame evaluation
+    int egResult = 1;
+
+    if (board.isSpEvalCandidate()){
+        U64 materialKey = board.getMaterialKey();
+        const egEvalEntry &spEntry = myEvalHash.entries[egHashSlot(materialKey)];
 
-    if (myEvalHash[index].key == board.getpCountKey().getValue() && spEval != nullptr){
-        egResult = spEval(board, color);
-        if (spevType == RETURN_SCORE) return egResult;
+        if (spEntry.key == materialKey && spEntry.eFunction != nullptr){
+            egResult = spEntry.eFunction(board, color);
+            if (spEntry.evalType == RETURN_SCORE) return egResult;
+        }
     }
 
 
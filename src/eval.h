@@ -160,10 +160,6 @@ inline int evaluateMain(const Board &, Color);
 int evaluate(const Board &, Color);
 
 
-void initEG();
-
-inline void egHashAdd(std::string , egEvalFunction, egEntryType);
-
 int evaluateDraw(const Board &, Color);
 int evaluateRookMinor_Rook(const Board &, Color);
 int evaluateQueen_vs_X(const Board &, Color);
@@ -180,6 +176,7 @@ int evaluateBN_Mating(const Board &, Color);
 int evaluateKnights_vs_Pawn(const Board &, Color);
 int evaluateRookPawn_vs_Rook(const Board &, Color);
 int evaluateKingPawn_vs_King(const Board &, Color);
+int evaluateKingPawn_vs_KingPawn(const Board &, Color);
 int evaluateBishopPawn_vs_KP(const Board &, Color);
 
 /**
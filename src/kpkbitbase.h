@@ -0,0 +1,1548 @@
+// KPK bitbase, generated by "make kpkgen" (tools/kpkgen.cc), do not edit.
+// Bit is set for positions won by the side with a pawn,
+// see Bitbase::kpk_get_index() for the indexing.
+#ifndef KPKBITBASE_H
+#define KPKBITBASE_H
+
+#include "endgame.h"
+
+const uint8_t KPK_Bitbase[KPK_SIZE / 8] = {
+  0xfc,0xfc,0xff,0xff,0xff,0xff,0xfe,0xff,0xf8,0xf8,0xff,0xff,0xff,0xff,0xfe,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xff,0xfe,0xff,0xe3,0xe3,0xff,0xff,0xff,0xff,0xfe,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xff,0xfe,0xff,0x8f,0x8f,0xff,0xff,0xff,0xff,0xfe,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xff,0xfe,0xff,0x3f,0x3f,0xff,0xff,0xff,0xff,0xfe,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xff,0xfe,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xfe,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xfe,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xfe,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xff,0xfe,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xff,0xfe,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfe,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xff,0xfe,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xff,0xfe,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfe,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xff,0xfe,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfe,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xff,0xfe,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfe,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xff,0xfe,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfe,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xff,0xfe,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfe,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfe,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xff,0xfe,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfe,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfe,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xfc,0xfe,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfe,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf1,0xfe,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfe,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc7,0xfe,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfe,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1f,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfe,0xff,
+  0xff,0xff,0xff,0xff,0xfc,0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,
+  0xff,0xff,0xff,0xff,0xf1,0xf1,0xf0,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe2,0xff,
+  0xff,0xff,0xff,0xff,0xc7,0xc7,0xc6,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8e,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1f,0x1e,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3e,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xff,0xff,0xff,0xff,0xff,0xf1,0xf0,0xf0,0xff,0xff,0xff,0xff,0xff,0xe3,0xe2,0xe3,
+  0xff,0xff,0xff,0xff,0xff,0xc7,0xc6,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8e,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1f,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,0xe2,0xe3,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0x8e,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0x3e,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xff,0xfe,0xff,0xf8,0xf8,0xff,0xff,0xff,0xff,0xfe,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xff,0xfe,0xff,0xe3,0xe3,0xff,0xff,0xff,0xff,0xfe,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xff,0xfe,0xff,0x8f,0x8f,0xff,0xff,0xff,0xff,0xfe,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xff,0xfe,0xff,0x3f,0x3f,0xff,0xff,0xff,0xff,0xfe,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xff,0xfe,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xfe,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xfe,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xfe,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xff,0xfe,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xff,0xfe,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfe,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xff,0xfe,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xff,0xfe,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfe,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xff,0xfe,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfe,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xff,0xfe,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfe,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xff,0xfe,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfe,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xff,0xfe,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfe,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfe,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xff,0xfe,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfe,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfe,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xfc,0xfe,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfe,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf1,0xfe,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfe,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc7,0xfe,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfe,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1f,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfe,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe2,0xfe,
+  0xff,0xff,0xff,0xff,0xc7,0xc7,0xc6,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8e,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1f,0x1e,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3e,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xe3,0xe2,0xe2,
+  0xff,0xff,0xff,0xff,0xff,0xc7,0xc6,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8e,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1f,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xe2,0xe2,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0x8e,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0x3e,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xff,0xfd,0xff,0xf8,0xf8,0xff,0xff,0xff,0xff,0xfd,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xff,0xfd,0xff,0xe3,0xe3,0xff,0xff,0xff,0xff,0xfd,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xff,0xfd,0xff,0x8f,0x8f,0xff,0xff,0xff,0xff,0xfd,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xff,0xfd,0xff,0x3f,0x3f,0xff,0xff,0xff,0xff,0xfd,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xff,0xfd,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xfd,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xfd,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xfd,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xff,0xfd,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xff,0xfd,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfd,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xff,0xfd,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xff,0xfd,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfd,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xff,0xfd,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfd,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xff,0xfd,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfd,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xff,0xfd,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfd,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xff,0xfd,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfd,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfd,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xff,0xfd,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfd,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xff,0xfd,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfd,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xfc,0xfd,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfd,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf1,0xfd,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfd,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc7,0xfd,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfd,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1f,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfd,0xff,
+  0xff,0xff,0xff,0xff,0xfc,0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,
+  0xff,0xff,0xff,0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe1,0xff,
+  0xff,0xff,0xff,0xff,0xc7,0xc7,0xc5,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8d,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1f,0x1d,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3d,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0xff,0xff,0xff,0xff,0xff,0xe3,0xe1,0xe3,
+  0xff,0xff,0xff,0xff,0xff,0xc7,0xc5,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8d,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1f,0x1d,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3d,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0a,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xe1,0xe3,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xc5,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0x8d,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x1d,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0x3d,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xff,0xfd,0xff,0xf8,0xf8,0xff,0xff,0xff,0xff,0xfd,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xff,0xfd,0xff,0xe3,0xe3,0xff,0xff,0xff,0xff,0xfd,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xff,0xfd,0xff,0x8f,0x8f,0xff,0xff,0xff,0xff,0xfd,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xff,0xfd,0xff,0x3f,0x3f,0xff,0xff,0xff,0xff,0xfd,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xff,0xfd,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xfd,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xfd,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xfd,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xff,0xfd,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xff,0xfd,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfd,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xff,0xfd,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xff,0xfd,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfd,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xff,0xfd,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfd,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xff,0xfd,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfd,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xff,0xfd,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfd,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xff,0xfd,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfd,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfd,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xff,0xfd,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfd,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xff,0xfd,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfd,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xfc,0xfd,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfd,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf1,0xfd,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfd,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc7,0xfd,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfd,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1f,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfd,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x0f,
+  0xff,0xff,0xff,0xff,0xc7,0xc7,0xc5,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8d,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1f,0x1d,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3d,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x03,
+  0xff,0xff,0xff,0xff,0xff,0xc7,0xc5,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8d,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1f,0x1d,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3d,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x0f,0x01,0x03,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xc5,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0x8d,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x1d,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0x3d,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xff,0xfb,0xff,0xf8,0xf8,0xff,0xff,0xff,0xff,0xfb,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xff,0xfb,0xff,0xe3,0xe3,0xff,0xff,0xff,0xff,0xfb,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xff,0xfb,0xff,0x8f,0x8f,0xff,0xff,0xff,0xff,0xfb,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xff,0xfb,0xff,0x3f,0x3f,0xff,0xff,0xff,0xff,0xfb,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xff,0xfb,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xfb,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xfb,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xfb,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xff,0xfb,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xff,0xfb,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfb,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xff,0xfb,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xff,0xfb,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfb,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xff,0xfb,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfb,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xff,0xfb,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfb,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xff,0xfb,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfb,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xff,0xfb,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfb,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfb,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xff,0xfb,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfb,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xff,0xfb,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfb,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xfc,0xfb,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfb,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf1,0xfb,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfb,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc7,0xfb,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfb,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1f,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfb,0xff,
+  0xff,0xff,0xff,0xff,0xfc,0xfc,0xf8,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,
+  0xff,0xff,0xff,0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,
+  0xff,0xff,0xff,0xff,0xc7,0xc7,0xc3,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8b,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1f,0x1b,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3b,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xfc,0xf8,0xfc,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,
+  0xff,0xff,0xff,0xff,0xff,0xc7,0xc3,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8b,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1f,0x1b,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3b,0x3f,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1f,0x15,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xc3,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0x8b,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x1b,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0x3b,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xff,0xfb,0xff,0xf8,0xf8,0xff,0xff,0xff,0xff,0xfb,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xff,0xfb,0xff,0xe3,0xe3,0xff,0xff,0xff,0xff,0xfb,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xff,0xfb,0xff,0x8f,0x8f,0xff,0xff,0xff,0xff,0xfb,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xff,0xfb,0xff,0x3f,0x3f,0xff,0xff,0xff,0xff,0xfb,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xff,0xfb,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xfb,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xfb,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xfb,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xff,0xfb,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xff,0xfb,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfb,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xff,0xfb,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xff,0xfb,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfb,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xff,0xfb,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfb,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xff,0xfb,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfb,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xff,0xfb,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfb,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xff,0xfb,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfb,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfb,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xff,0xfb,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfb,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xff,0xfb,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfb,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xfc,0xfb,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfb,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf1,0xfb,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfb,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc7,0xfb,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfb,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1f,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfb,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x18,0x1f,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x0e,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x0e,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x03,0x1f,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8b,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1f,0x1b,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3b,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x18,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x03,0x07,0xff,0xff,0xff,0xff,0xff,0x8f,0x8b,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1f,0x1b,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3b,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x18,0x1c,0x00,0x00,0x00,0x00,0x00,0x04,0x08,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x1f,0x03,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0x8b,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x1b,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0x3b,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xff,0xf7,0xff,0xf8,0xf8,0xff,0xff,0xff,0xff,0xf7,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xff,0xf7,0xff,0xe3,0xe3,0xff,0xff,0xff,0xff,0xf7,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xff,0xf7,0xff,0x8f,0x8f,0xff,0xff,0xff,0xff,0xf7,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xff,0xf7,0xff,0x3f,0x3f,0xff,0xff,0xff,0xff,0xf7,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xff,0xf7,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xf7,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xf7,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xf7,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xff,0xf7,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xff,0xf7,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xff,0xf7,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xff,0xf7,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xff,0xf7,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xf7,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xff,0xf7,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xf7,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xff,0xf7,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xf7,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xff,0xf7,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xf7,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xff,0xf7,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xf7,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xff,0xf7,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xf7,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xff,0xf7,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xf7,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xfc,0xf7,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xf7,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf1,0xf7,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xf7,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc7,0xf7,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xf7,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1f,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xf7,0xff,
+  0xff,0xff,0xff,0xff,0xfc,0xfc,0xf4,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf0,0xff,
+  0xff,0xff,0xff,0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,
+  0xff,0xff,0xff,0xff,0xc7,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x87,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1f,0x17,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x37,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xfc,0xf4,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf0,0xf8,
+  0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x06,0x06,0x06,0xff,0xff,0xff,0xff,0xff,0x8f,0x87,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1f,0x17,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x37,0x3f,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0xf8,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x2a,0x22,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x87,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x17,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0x37,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xff,0xf7,0xff,0xf8,0xf8,0xff,0xff,0xff,0xff,0xf7,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xff,0xf7,0xff,0xe3,0xe3,0xff,0xff,0xff,0xff,0xf7,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xff,0xf7,0xff,0x8f,0x8f,0xff,0xff,0xff,0xff,0xf7,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xff,0xf7,0xff,0x3f,0x3f,0xff,0xff,0xff,0xff,0xf7,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xff,0xf7,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xf7,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xf7,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xf7,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xff,0xf7,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xff,0xf7,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xff,0xf7,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xff,0xf7,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xff,0xf7,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xf7,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xff,0xf7,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xf7,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xff,0xf7,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xf7,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xff,0xf7,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xf7,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xff,0xf7,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xf7,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xff,0xf7,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xf7,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xff,0xf7,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xf7,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xfc,0xf7,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xf7,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf1,0xf7,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xf7,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc7,0xf7,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xf7,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1f,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xf7,0xff,
+  0xff,0xff,0xff,0xff,0xfc,0xfc,0xf4,0xff,0x00,0x00,0x00,0x00,0x00,0x38,0x30,0x3e,
+  0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x1c,0x00,0x00,0x00,0x00,0x00,0x0e,0x06,0x3e,
+  0xff,0xff,0xff,0xff,0x1f,0x1f,0x17,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x37,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xfc,0xf4,0xfc,0x00,0x00,0x00,0x00,0x00,0x38,0x30,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x06,0x0e,
+  0xff,0xff,0xff,0xff,0xff,0x1f,0x17,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x37,0x3f,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0xfc,0x00,0x00,0x00,0x00,0x00,0x3e,0x30,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x08,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x3e,0x06,0x0e,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x17,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0x37,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xfe,0xff,0xff,0xf8,0xf8,0xff,0xff,0xff,0xfe,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xfe,0xff,0xff,0xe3,0xe3,0xff,0xff,0xff,0xfe,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xfe,0xff,0xff,0x8f,0x8f,0xff,0xff,0xff,0xfe,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xfe,0xff,0xff,0x3f,0x3f,0xff,0xff,0xff,0xfe,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xfe,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfe,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xfe,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfe,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xfe,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfe,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xfe,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfe,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xfe,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfe,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfe,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xfe,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfe,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfe,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xfe,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfe,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xfe,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfe,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xfe,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfe,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfe,0xff,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf0,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe2,0xff,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc6,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8e,0xff,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1e,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3e,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x07,0xff,0xff,0xff,0xff,0xe3,0xe2,0xe3,0xff,
+  0xff,0xff,0xff,0xff,0xc7,0xc6,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8e,0x8f,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xe2,0xe3,0xe3,
+  0xff,0xff,0xff,0xff,0xff,0xc6,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0x8e,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1e,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3e,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xfe,0xe3,0xe3,
+  0xff,0xff,0xff,0xff,0xff,0xfe,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0xfe,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xfe,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0xfe,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xfe,0xff,0xff,0xf8,0xf8,0xff,0xff,0xff,0xfe,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xfe,0xff,0xff,0xe3,0xe3,0xff,0xff,0xff,0xfe,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xfe,0xff,0xff,0x8f,0x8f,0xff,0xff,0xff,0xfe,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xfe,0xff,0xff,0x3f,0x3f,0xff,0xff,0xff,0xfe,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xfe,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfe,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xfe,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfe,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xfe,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfe,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xfe,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfe,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xfe,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfe,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfe,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xfe,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfe,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfe,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xfe,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfe,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xfe,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfe,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xfe,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfe,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfe,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x00,0x00,0x02,0x02,0x0f,0x07,
+  0xff,0xff,0xff,0xc7,0xc7,0xc6,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8e,0xff,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1e,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3e,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x06,
+  0xff,0xff,0xff,0xff,0xc7,0xc6,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8e,0x8f,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,
+  0xff,0xff,0xff,0xff,0xff,0xc6,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0x8e,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1e,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3e,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x02,0x02,
+  0xff,0xff,0xff,0xff,0xff,0xfe,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0xfe,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xfe,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0xfe,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xfd,0xff,0xff,0xf8,0xf8,0xff,0xff,0xff,0xfd,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xfd,0xff,0xff,0xe3,0xe3,0xff,0xff,0xff,0xfd,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xfd,0xff,0xff,0x8f,0x8f,0xff,0xff,0xff,0xfd,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xfd,0xff,0xff,0x3f,0x3f,0xff,0xff,0xff,0xfd,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xfd,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfd,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xfd,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfd,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xfd,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfd,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xfd,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfd,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xfd,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfd,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfd,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xfd,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfd,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xfd,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfd,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xfd,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfd,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xfd,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfd,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xfd,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfd,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfd,0xff,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe1,0xff,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc5,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8d,0xff,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1d,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3d,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x0c,0x0c,0x0c,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x07,0x00,0x00,0x00,0x07,0x03,0x01,0x03,0x0f,
+  0xff,0xff,0xff,0xff,0xc7,0xc5,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8d,0x8f,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1d,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3d,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x1f,0x01,0x03,0x03,
+  0xff,0xff,0xff,0xff,0xff,0xc5,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0x8d,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1d,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3d,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x0f,0x08,0x0c,0x04,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0f,0x09,0x01,0x01,0x00,0x00,0x00,0x1f,0x1f,0x1d,0x03,0x03,
+  0xff,0xff,0xff,0xff,0xff,0xfd,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0xfd,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xfd,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0xfd,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xfd,0xff,0xff,0xf8,0xf8,0xff,0xff,0xff,0xfd,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xfd,0xff,0xff,0xe3,0xe3,0xff,0xff,0xff,0xfd,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xfd,0xff,0xff,0x8f,0x8f,0xff,0xff,0xff,0xfd,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xfd,0xff,0xff,0x3f,0x3f,0xff,0xff,0xff,0xfd,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xfd,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfd,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xfd,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfd,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xfd,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfd,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xfd,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfd,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xfd,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfd,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfd,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xfd,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfd,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xfd,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfd,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xfd,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfd,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xfd,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfd,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xfd,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfd,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfd,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x04,0x04,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,
+  0x00,0x00,0x00,0x00,0x01,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x0f,0x07,
+  0x00,0x00,0x00,0x07,0x07,0x05,0x1f,0x0f,0xff,0xff,0xff,0x8f,0x8f,0x8d,0xff,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1d,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3d,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x03,0x07,
+  0x00,0x00,0x00,0x07,0x07,0x05,0x07,0x0f,0xff,0xff,0xff,0xff,0x8f,0x8d,0x8f,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1d,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3d,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x0f,0x01,0x03,0x03,
+  0x00,0x00,0x00,0x07,0x1f,0x05,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0x8d,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1d,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3d,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x05,0x01,0x01,0x00,0x00,0x00,0x00,0x0f,0x09,0x03,0x03,
+  0x00,0x00,0x00,0x1f,0x1f,0x1d,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xfd,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xfd,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0xfd,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xfb,0xff,0xff,0xf8,0xf8,0xff,0xff,0xff,0xfb,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xfb,0xff,0xff,0xe3,0xe3,0xff,0xff,0xff,0xfb,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xfb,0xff,0xff,0x8f,0x8f,0xff,0xff,0xff,0xfb,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xfb,0xff,0xff,0x3f,0x3f,0xff,0xff,0xff,0xfb,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xfb,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfb,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xfb,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfb,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xfb,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfb,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xfb,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfb,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xfb,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfb,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfb,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xfb,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfb,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xfb,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfb,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xfb,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfb,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xfb,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfb,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xfb,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfb,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfb,0xff,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xf8,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc3,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8b,0xff,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x1b,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3b,0xff,0xff,
+  0x00,0x00,0x00,0x3e,0x3c,0x38,0x3c,0x3f,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x1e,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x0f,
+  0x00,0x00,0x00,0x0f,0x07,0x03,0x07,0x1f,0xff,0xff,0xff,0xff,0x8f,0x8b,0x8f,0xff,
+  0xff,0xff,0xff,0xff,0x1f,0x1b,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3b,0x3f,0xff,
+  0x00,0x00,0x00,0x3f,0x3f,0x38,0x3c,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x3f,0x3f,0x03,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0x8b,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0x1b,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3b,0x3f,0x3f,
+  0x00,0x00,0x00,0x3f,0x3f,0x3b,0x3c,0x3c,0x00,0x00,0x00,0x00,0x1f,0x19,0x18,0x18,
+  0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x13,0x03,0x03,
+  0x00,0x00,0x00,0x3f,0x3f,0x3b,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xfb,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xff,0xfb,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0xfb,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xfb,0xff,0xff,0xf8,0xf8,0xff,0xff,0xff,0xfb,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xfb,0xff,0xff,0xe3,0xe3,0xff,0xff,0xff,0xfb,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xfb,0xff,0xff,0x8f,0x8f,0xff,0xff,0xff,0xfb,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xfb,0xff,0xff,0x3f,0x3f,0xff,0xff,0xff,0xfb,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xfb,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xfb,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xfb,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xfb,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xfb,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xfb,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xfb,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xfb,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xfb,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfb,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfb,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xfb,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfb,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xfb,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfb,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xfb,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfb,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xfb,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfb,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xfb,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfb,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfb,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x1c,0x18,0x1f,0x1e,0x00,0x00,0x00,0x00,0x08,0x08,0x0e,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x0e,0x00,
+  0x00,0x00,0x00,0x00,0x07,0x03,0x1f,0x0f,0x00,0x00,0x00,0x0f,0x0f,0x0b,0x3f,0x1f,
+  0xff,0xff,0xff,0x1f,0x1f,0x1b,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3b,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x1c,0x18,0x1c,0x1e,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,
+  0x00,0x00,0x00,0x00,0x07,0x03,0x07,0x0f,0x00,0x00,0x00,0x0f,0x0f,0x0b,0x0f,0x1f,
+  0xff,0xff,0xff,0xff,0x1f,0x1b,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3b,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x1f,0x18,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,
+  0x00,0x00,0x00,0x00,0x1f,0x03,0x07,0x07,0x00,0x00,0x00,0x0f,0x3f,0x0b,0x0f,0x0f,
+  0xff,0xff,0xff,0xff,0xff,0x1b,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3b,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x1f,0x19,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x0a,0x08,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x1f,0x13,0x07,0x07,0x00,0x00,0x00,0x3f,0x3f,0x3b,0x0f,0x0f,
+  0xff,0xff,0xff,0xff,0xff,0xfb,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0xfb,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xf7,0xff,0xff,0xf8,0xf8,0xff,0xff,0xff,0xf7,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xf7,0xff,0xff,0xe3,0xe3,0xff,0xff,0xff,0xf7,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xf7,0xff,0xff,0x8f,0x8f,0xff,0xff,0xff,0xf7,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xf7,0xff,0xff,0x3f,0x3f,0xff,0xff,0xff,0xf7,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xf7,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xf7,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xf7,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xf7,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xf7,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xf7,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xf7,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xf7,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xf7,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xf7,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xf7,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xf7,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xf7,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xf7,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xf7,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xf7,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xf7,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xf7,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xf7,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xf7,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xf7,0xff,0xff,
+  0xff,0xff,0xff,0xfc,0xfc,0xf4,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf0,0xff,0xff,
+  0xff,0xff,0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,
+  0xff,0xff,0xff,0xc7,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x87,0xff,0xff,
+  0xff,0xff,0xff,0x1f,0x1f,0x17,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x37,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xfc,0xf4,0xfc,0xff,0x00,0x00,0x00,0x7c,0x78,0x70,0x78,0x7e,
+  0x00,0x00,0x00,0x00,0x30,0x30,0x30,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x06,0x06,0x06,0x1e,0x00,0x00,0x00,0x1f,0x0f,0x07,0x0f,0x3f,
+  0xff,0xff,0xff,0xff,0x1f,0x17,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x37,0x3f,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xf4,0xfc,0xfc,0x00,0x00,0x00,0x7f,0x7f,0x70,0x78,0x78,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x7f,0x07,0x0f,0x0f,
+  0xff,0xff,0xff,0xff,0xff,0x17,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x37,0x3f,0x3f,
+  0xff,0xff,0xff,0xff,0xff,0xf7,0xfc,0xfc,0x00,0x00,0x00,0x7f,0x7f,0x77,0x78,0x78,
+  0x00,0x00,0x00,0x00,0x3e,0x32,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3e,0x26,0x06,0x06,0x00,0x00,0x00,0x7f,0x7f,0x77,0x0f,0x0f,
+  0xff,0xff,0xff,0xff,0xff,0xf7,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0xf7,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xf7,0xff,0xff,0xf8,0xf8,0xff,0xff,0xff,0xf7,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xf7,0xff,0xff,0xe3,0xe3,0xff,0xff,0xff,0xf7,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xf7,0xff,0xff,0x8f,0x8f,0xff,0xff,0xff,0xf7,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xff,0xf7,0xff,0xff,0x3f,0x3f,0xff,0xff,0xff,0xf7,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xf7,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xf7,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xf7,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xf7,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xf7,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xff,0xf7,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xff,0xf7,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xff,0xf7,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xf7,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xf7,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xf7,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xf7,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xff,0xf7,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xf7,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xf7,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xf7,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xf7,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xf7,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xf7,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xf7,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1f,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xf7,0xff,0xff,
+  0x00,0x00,0x00,0x7c,0x7c,0x74,0x7f,0x7e,0x00,0x00,0x00,0x00,0x38,0x30,0x3e,0x3c,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,
+  0x00,0x00,0x00,0x00,0x04,0x04,0x1c,0x00,0x00,0x00,0x00,0x00,0x0e,0x06,0x3e,0x1e,
+  0x00,0x00,0x00,0x1f,0x1f,0x17,0x7f,0x3f,0xff,0xff,0xff,0x3f,0x3f,0x37,0xff,0xff,
+  0x00,0x00,0x00,0x7c,0x7c,0x74,0x7c,0x7e,0x00,0x00,0x00,0x00,0x38,0x30,0x38,0x3c,
+  0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x06,0x0e,0x1e,
+  0x00,0x00,0x00,0x1f,0x1f,0x17,0x1f,0x3f,0xff,0xff,0xff,0xff,0x3f,0x37,0x3f,0xff,
+  0x00,0x00,0x00,0x7c,0x7f,0x74,0x7c,0x7c,0x00,0x00,0x00,0x00,0x3e,0x30,0x38,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x3e,0x06,0x0e,0x0e,
+  0x00,0x00,0x00,0x1f,0x7f,0x17,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x37,0x3f,0x3f,
+  0x00,0x00,0x00,0x7f,0x7f,0x77,0x7c,0x7c,0x00,0x00,0x00,0x00,0x3e,0x32,0x38,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x14,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x14,0x04,0x04,0x00,0x00,0x00,0x00,0x3e,0x26,0x0e,0x0e,
+  0x00,0x00,0x00,0x7f,0x7f,0x77,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0xf7,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xfe,0xff,0xff,0xff,0xf8,0xf8,0xff,0xff,0xfe,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xfe,0xff,0xff,0xff,0xe3,0xe3,0xff,0xff,0xfe,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xfe,0xff,0xff,0xff,0x8f,0x8f,0xff,0xff,0xfe,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,0xff,0xff,0xfe,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xfe,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfe,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xfe,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfe,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xfe,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfe,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfe,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xfe,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfe,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xfe,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfe,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xfe,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfe,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfe,0xff,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf0,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe2,0xff,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc6,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8e,0xff,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1e,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3e,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x07,0x07,0x00,0x00,0x00,0x03,0x02,0x03,0x0f,0x0f,
+  0xff,0xff,0xff,0xc7,0xc6,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8e,0x8f,0xff,0xff,
+  0xff,0xff,0xff,0x1f,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x02,0x03,0x03,0x07,
+  0xff,0xff,0xff,0xff,0xc6,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0x8e,0x8f,0x8f,0xff,
+  0xff,0xff,0xff,0xff,0x1e,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3e,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,
+  0xff,0xff,0xff,0xff,0xfe,0xc7,0xc7,0xc7,0xff,0xff,0xff,0xff,0xfe,0x8f,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xfe,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfe,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x03,0x03,
+  0xff,0xff,0xff,0xff,0xfe,0xff,0xc7,0xc7,0xff,0xff,0xff,0xff,0xfe,0xff,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xfe,0xff,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfe,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xfe,0xff,0xff,0xff,0xf8,0xf8,0xff,0xff,0xfe,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xfe,0xff,0xff,0xff,0xe3,0xe3,0xff,0xff,0xfe,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xfe,0xff,0xff,0xff,0x8f,0x8f,0xff,0xff,0xfe,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,0xff,0xff,0xfe,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xfe,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfe,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xfe,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfe,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xfe,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfe,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfe,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xfe,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfe,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xfe,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfe,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xfe,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfe,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfe,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x03,0x00,0x00,0x00,0x00,0x02,0x02,0x0f,0x07,0x07,
+  0x00,0x00,0x00,0x07,0x06,0x1f,0x0f,0x0f,0xff,0xff,0x8f,0x8f,0x8e,0xff,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1e,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3e,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x06,0x02,
+  0x00,0x00,0x00,0x00,0x06,0x07,0x0f,0x07,0xff,0xff,0xff,0x8f,0x8e,0x8f,0xff,0xff,
+  0xff,0xff,0xff,0x1f,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0x8e,0x8f,0x8f,0xff,
+  0xff,0xff,0xff,0xff,0x1e,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3e,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xfe,0x8f,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xfe,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfe,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xfe,0xff,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xfe,0xff,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfe,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xfd,0xff,0xff,0xff,0xf8,0xf8,0xff,0xff,0xfd,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xfd,0xff,0xff,0xff,0xe3,0xe3,0xff,0xff,0xfd,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xfd,0xff,0xff,0xff,0x8f,0x8f,0xff,0xff,0xfd,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xfd,0xff,0xff,0xff,0x3f,0x3f,0xff,0xff,0xfd,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xfd,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfd,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xfd,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfd,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xfd,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfd,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xfd,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfd,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xfd,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfd,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xfd,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfd,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xfd,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfd,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfd,0xff,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe1,0xff,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc5,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8d,0xff,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1d,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3d,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x0c,0x0c,0x0c,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x01,0x01,0x07,0x00,0x00,0x00,0x07,0x03,0x01,0x03,0x0f,0x0f,
+  0x00,0x00,0x07,0x07,0x05,0x07,0x1f,0x1f,0xff,0xff,0xff,0x8f,0x8d,0x8f,0xff,0xff,
+  0xff,0xff,0xff,0x1f,0x1d,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3d,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x03,0x03,0x07,
+  0x00,0x00,0x07,0x0f,0x05,0x07,0x07,0x0f,0xff,0xff,0xff,0xff,0x8d,0x8f,0x8f,0xff,
+  0xff,0xff,0xff,0xff,0x1d,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3d,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x0c,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x03,0x0d,0x03,0x03,0x03,
+  0x00,0x00,0x07,0x1f,0x1d,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xfd,0x8f,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xfd,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfd,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x0d,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,0x0d,0x0f,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x0d,0x0f,0x01,0x01,0x00,0x00,0x00,0x03,0x1d,0x1f,0x03,0x03,
+  0x00,0x00,0x07,0x1f,0x3d,0x3f,0x07,0x07,0xff,0xff,0xff,0xff,0xfd,0xff,0x8f,0x8f,
+  0xff,0xff,0xff,0xff,0xfd,0xff,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfd,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xfd,0xff,0xff,0xff,0xf8,0xf8,0xff,0xff,0xfd,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xfd,0xff,0xff,0xff,0xe3,0xe3,0xff,0xff,0xfd,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xfd,0xff,0xff,0xff,0x8f,0x8f,0xff,0xff,0xfd,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xfd,0xff,0xff,0xff,0x3f,0x3f,0xff,0xff,0xfd,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xfd,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfd,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xfd,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfd,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xfd,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfd,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xfd,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfd,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xfd,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfd,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xfd,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfd,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xfd,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfd,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfd,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x04,0x04,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x0f,0x07,0x00,
+  0x00,0x00,0x07,0x07,0x05,0x1f,0x0f,0x0f,0x00,0x00,0x07,0x0f,0x0d,0x3f,0x1f,0x1f,
+  0xff,0xff,0x1f,0x1f,0x1d,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3d,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x03,0x07,0x00,
+  0x00,0x00,0x00,0x03,0x05,0x07,0x0f,0x07,0x00,0x00,0x07,0x0f,0x0d,0x0f,0x1f,0x0f,
+  0xff,0xff,0xff,0x1f,0x1d,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3d,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x00,
+  0x00,0x00,0x00,0x03,0x05,0x07,0x07,0x07,0x00,0x00,0x07,0x0f,0x0d,0x0f,0x0f,0x0f,
+  0xff,0xff,0xff,0xff,0x1d,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3d,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,
+  0x00,0x00,0x00,0x03,0x0d,0x07,0x07,0x07,0x00,0x00,0x07,0x0f,0x1d,0x0f,0x0f,0x0f,
+  0xff,0xff,0xff,0xff,0xfd,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfd,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x0f,0x03,0x03,
+  0x00,0x00,0x00,0x03,0x0d,0x1f,0x07,0x07,0x00,0x00,0x07,0x1f,0x1d,0x3f,0x0f,0x0f,
+  0xff,0xff,0xff,0xff,0xfd,0xff,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfd,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xfb,0xff,0xff,0xff,0xf8,0xf8,0xff,0xff,0xfb,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xfb,0xff,0xff,0xff,0xe3,0xe3,0xff,0xff,0xfb,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xfb,0xff,0xff,0xff,0x8f,0x8f,0xff,0xff,0xfb,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xfb,0xff,0xff,0xff,0x3f,0x3f,0xff,0xff,0xfb,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xfb,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfb,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xfb,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfb,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xfb,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfb,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xfb,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfb,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xfb,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfb,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xfb,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfb,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xfb,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfb,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfb,0xff,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xf8,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc3,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8b,0xff,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x1b,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3b,0xff,0xff,0xff,
+  0x00,0x00,0x3e,0x3c,0x38,0x3c,0x3f,0x3f,0x00,0x00,0x00,0x18,0x18,0x18,0x1e,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x0f,0x00,
+  0x00,0x00,0x0f,0x07,0x03,0x07,0x1f,0x1f,0x00,0x00,0x0f,0x0f,0x0b,0x0f,0x3f,0x3f,
+  0xff,0xff,0xff,0x1f,0x1b,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3b,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x3c,0x38,0x3c,0x3c,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x07,0x03,0x07,0x07,0x0f,0x00,0x00,0x0f,0x1f,0x0b,0x0f,0x0f,0x1f,
+  0xff,0xff,0xff,0xff,0x1b,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3b,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x3c,0x3b,0x3c,0x3c,0x3c,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,
+  0x00,0x00,0x00,0x07,0x1b,0x07,0x07,0x07,0x00,0x00,0x0f,0x3f,0x3b,0x0f,0x0f,0x0f,
+  0xff,0xff,0xff,0xff,0xfb,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfb,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x3c,0x3b,0x3f,0x3c,0x3c,0x00,0x00,0x00,0x00,0x1b,0x1f,0x18,0x18,
+  0x00,0x00,0x00,0x00,0x1b,0x1f,0x11,0x00,0x00,0x00,0x00,0x00,0x1b,0x1f,0x03,0x03,
+  0x00,0x00,0x00,0x07,0x3b,0x3f,0x07,0x07,0x00,0x00,0x0f,0x3f,0x7b,0x7f,0x0f,0x0f,
+  0xff,0xff,0xff,0xff,0xfb,0xff,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfb,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xfb,0xff,0xff,0xff,0xf8,0xf8,0xff,0xff,0xfb,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xfb,0xff,0xff,0xff,0xe3,0xe3,0xff,0xff,0xfb,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xfb,0xff,0xff,0xff,0x8f,0x8f,0xff,0xff,0xfb,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xfb,0xff,0xff,0xff,0x3f,0x3f,0xff,0xff,0xfb,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xfb,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xfb,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xfb,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xfb,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xfb,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xfb,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xfb,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xfb,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xfb,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfb,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xfb,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfb,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xfb,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfb,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfb,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x1c,0x18,0x1f,0x1e,0x00,0x00,0x00,0x00,0x08,0x08,0x0e,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x0e,0x00,0x00,
+  0x00,0x00,0x00,0x07,0x03,0x1f,0x0f,0x00,0x00,0x00,0x0f,0x0f,0x0b,0x3f,0x1f,0x1f,
+  0x00,0x00,0x0f,0x1f,0x1b,0x7f,0x3f,0x3f,0xff,0xff,0x3f,0x3f,0x3b,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x1c,0x18,0x1c,0x1e,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,
+  0x00,0x00,0x00,0x07,0x03,0x07,0x0f,0x00,0x00,0x00,0x00,0x07,0x0b,0x0f,0x1f,0x0f,
+  0x00,0x00,0x0f,0x1f,0x1b,0x1f,0x3f,0x1f,0xff,0xff,0xff,0x3f,0x3b,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x18,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x03,0x07,0x07,0x00,0x00,0x00,0x00,0x07,0x0b,0x0f,0x0f,0x0f,
+  0x00,0x00,0x0f,0x1f,0x1b,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0x3b,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x18,0x1c,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,
+  0x00,0x00,0x00,0x00,0x03,0x07,0x07,0x07,0x00,0x00,0x00,0x07,0x1b,0x0f,0x0f,0x0f,
+  0x00,0x00,0x0f,0x1f,0x3b,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfb,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x18,0x1f,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x0e,0x08,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x03,0x1f,0x07,0x07,0x00,0x00,0x00,0x07,0x1b,0x3f,0x0f,0x0f,
+  0x00,0x00,0x0f,0x3f,0x3b,0x7f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfb,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xf7,0xff,0xff,0xff,0xf8,0xf8,0xff,0xff,0xf7,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xf7,0xff,0xff,0xff,0xe3,0xe3,0xff,0xff,0xf7,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xf7,0xff,0xff,0xff,0x8f,0x8f,0xff,0xff,0xf7,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xf7,0xff,0xff,0xff,0x3f,0x3f,0xff,0xff,0xf7,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xf7,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xf7,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xf7,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xf7,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xf7,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xf7,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xf7,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xf7,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xf7,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xf7,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xf7,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xf7,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xf7,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xf7,0xff,0xff,0xff,
+  0xff,0xff,0xfc,0xfc,0xf4,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf0,0xff,0xff,0xff,
+  0xff,0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,
+  0xff,0xff,0xc7,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x87,0xff,0xff,0xff,
+  0xff,0xff,0x1f,0x1f,0x17,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x37,0xff,0xff,0xff,
+  0x00,0x00,0xfc,0xfc,0xf4,0xfc,0xff,0xff,0x00,0x00,0x7c,0x78,0x70,0x78,0x7e,0x7e,
+  0x00,0x00,0x00,0x30,0x30,0x30,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x06,0x06,0x06,0x1e,0x00,0x00,0x00,0x1f,0x0f,0x07,0x0f,0x3f,0x3f,
+  0x00,0x00,0x1f,0x1f,0x17,0x1f,0x7f,0x7f,0xff,0xff,0xff,0x3f,0x37,0x3f,0xff,0xff,
+  0x00,0x00,0xfc,0xfe,0xf4,0xfc,0xfc,0xfe,0x00,0x00,0x00,0x78,0x70,0x78,0x78,0x7c,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x07,0x0f,0x0f,0x1f,
+  0x00,0x00,0x1f,0x3f,0x17,0x1f,0x1f,0x3f,0xff,0xff,0xff,0xff,0x37,0x3f,0x3f,0xff,
+  0x00,0x00,0xfc,0xff,0xf7,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x78,0x76,0x78,0x78,0x78,
+  0x00,0x00,0x00,0x00,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x06,0x06,0x06,0x06,0x00,0x00,0x00,0x0f,0x37,0x0f,0x0f,0x0f,
+  0x00,0x00,0x1f,0x7f,0x77,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xf7,0x3f,0x3f,0x3f,
+  0x00,0x00,0xfc,0xff,0xf7,0xff,0xfc,0xfc,0x00,0x00,0x00,0x78,0x77,0x7f,0x78,0x78,
+  0x00,0x00,0x00,0x00,0x36,0x3e,0x30,0x30,0x00,0x00,0x00,0x00,0x36,0x3e,0x22,0x00,
+  0x00,0x00,0x00,0x00,0x36,0x3e,0x06,0x06,0x00,0x00,0x00,0x0f,0x77,0x7f,0x0f,0x0f,
+  0x00,0x00,0x1f,0x7f,0xf7,0xff,0x1f,0x1f,0xff,0xff,0xff,0xff,0xf7,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xf7,0xff,0xff,0xff,0xf8,0xf8,0xff,0xff,0xf7,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xf7,0xff,0xff,0xff,0xe3,0xe3,0xff,0xff,0xf7,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xf7,0xff,0xff,0xff,0x8f,0x8f,0xff,0xff,0xf7,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xff,0xf7,0xff,0xff,0xff,0x3f,0x3f,0xff,0xff,0xf7,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xf7,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xf7,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xf7,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xf7,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xff,0xf7,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xff,0xf7,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xff,0xf7,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xf7,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xf7,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xf7,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xf7,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xf7,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xf7,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x1f,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xf7,0xff,0xff,0xff,
+  0x00,0x00,0x7c,0x7c,0x74,0x7f,0x7e,0x7e,0x00,0x00,0x00,0x38,0x30,0x3e,0x3c,0x00,
+  0x00,0x00,0x00,0x10,0x10,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,
+  0x00,0x00,0x00,0x04,0x04,0x1c,0x00,0x00,0x00,0x00,0x00,0x0e,0x06,0x3e,0x1e,0x00,
+  0x00,0x00,0x1f,0x1f,0x17,0x7f,0x3f,0x3f,0x00,0x00,0x1f,0x3f,0x37,0xff,0x7f,0x7f,
+  0x00,0x00,0x00,0x78,0x74,0x7c,0x7e,0x7c,0x00,0x00,0x00,0x38,0x30,0x38,0x3c,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x06,0x0e,0x1e,0x00,
+  0x00,0x00,0x00,0x0f,0x17,0x1f,0x3f,0x1f,0x00,0x00,0x1f,0x3f,0x37,0x3f,0x7f,0x3f,
+  0x00,0x00,0x00,0x78,0x74,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x30,0x38,0x38,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x0e,0x0e,0x00,
+  0x00,0x00,0x00,0x0f,0x17,0x1f,0x1f,0x1f,0x00,0x00,0x1f,0x3f,0x37,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x78,0x76,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x30,0x38,0x38,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x06,0x0e,0x0e,0x0e,
+  0x00,0x00,0x00,0x0f,0x37,0x1f,0x1f,0x1f,0x00,0x00,0x1f,0x3f,0x77,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x78,0x76,0x7f,0x7c,0x7c,0x00,0x00,0x00,0x00,0x30,0x3e,0x38,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x04,0x04,0x00,0x00,0x00,0x00,0x06,0x3e,0x0e,0x0e,
+  0x00,0x00,0x00,0x0f,0x37,0x7f,0x1f,0x1f,0x00,0x00,0x1f,0x7f,0x77,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xfe,0xff,0xff,0xff,0xff,0xf8,0xf8,0xff,0xfe,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xfe,0xff,0xff,0xff,0xff,0xe3,0xe3,0xff,0xfe,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xfe,0xff,0xff,0xff,0xff,0x8f,0x8f,0xff,0xfe,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,0xff,0xfe,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xfe,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfe,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xfe,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfe,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xfe,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfe,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfe,0xff,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf0,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe2,0xff,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc6,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8e,0xff,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x1e,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3e,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0x07,0x07,0x00,0x00,0x00,0x03,0x02,0x03,0x0f,0x0f,0x07,
+  0x00,0x00,0x07,0x06,0x07,0x1f,0x1f,0x0f,0xff,0xff,0x8f,0x8e,0x8f,0xff,0xff,0xff,
+  0xff,0xff,0x1f,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0x3f,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x02,0x03,0x03,0x07,0x07,
+  0x00,0x00,0x00,0x06,0x07,0x07,0x0f,0x0f,0xff,0xff,0xff,0x8e,0x8f,0x8f,0xff,0xff,
+  0xff,0xff,0xff,0x1e,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3e,0x3f,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x07,
+  0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x0f,0xff,0xff,0xff,0xfe,0x8f,0x8f,0x8f,0xff,
+  0xff,0xff,0xff,0xfe,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfe,0x3f,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,
+  0x00,0x00,0x00,0x00,0x0f,0x07,0x07,0x07,0xff,0xff,0xff,0xfe,0xff,0x8f,0x8f,0x8f,
+  0xff,0xff,0xff,0xfe,0xff,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfe,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x03,0x03,
+  0x00,0x00,0x00,0x00,0x0f,0x0f,0x07,0x07,0xff,0xff,0xff,0xfe,0xff,0xff,0x8f,0x8f,
+  0xff,0xff,0xff,0xfe,0xff,0xff,0x1f,0x1f,0xff,0xff,0xff,0xfe,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xfe,0xff,0xff,0xff,0xff,0xf8,0xf8,0xff,0xfe,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xfe,0xff,0xff,0xff,0xff,0xe3,0xe3,0xff,0xfe,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xfe,0xff,0xff,0xff,0xff,0x8f,0x8f,0xff,0xfe,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,0xff,0xfe,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xfe,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfe,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xfe,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfe,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xfe,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfe,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfe,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x07,0x03,0x00,0x00,0x00,0x00,0x02,0x02,0x0f,0x07,0x07,0x00,
+  0x00,0x00,0x07,0x06,0x1f,0x0f,0x0f,0x07,0x00,0x00,0x0f,0x0e,0x3f,0x1f,0x1f,0x0f,
+  0xff,0x1f,0x1f,0x1e,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3e,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x06,0x02,0x00,
+  0x00,0x00,0x00,0x06,0x07,0x0f,0x07,0x07,0x00,0x00,0x00,0x0e,0x0f,0x1f,0x0f,0x0f,
+  0xff,0xff,0x1f,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0x3f,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x00,
+  0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0xff,0xff,0xff,0x1e,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3e,0x3f,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0xff,0xff,0xff,0xfe,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfe,0x3f,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0xff,0xff,0xff,0xfe,0xff,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfe,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0xff,0xff,0xff,0xfe,0xff,0xff,0x1f,0x1f,0xff,0xff,0xff,0xfe,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xfd,0xff,0xff,0xff,0xff,0xf8,0xf8,0xff,0xfd,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xfd,0xff,0xff,0xff,0xff,0xe3,0xe3,0xff,0xfd,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xfd,0xff,0xff,0xff,0xff,0x8f,0x8f,0xff,0xfd,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,0xff,0xfd,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xfd,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfd,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xfd,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfd,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xfd,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfd,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfd,0xff,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe1,0xff,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc5,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8d,0xff,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x1d,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3d,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x0c,0x0c,0x0c,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0x01,0x01,0x07,0x00,0x00,0x00,0x07,0x03,0x01,0x03,0x0f,0x0f,0x00,
+  0x00,0x07,0x07,0x05,0x07,0x1f,0x1f,0x0f,0x0f,0x1f,0x0f,0x0d,0x0f,0x3f,0x3f,0x1f,
+  0xff,0xff,0x1f,0x1d,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3d,0x3f,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x03,0x03,0x07,0x00,
+  0x00,0x07,0x0f,0x05,0x07,0x07,0x0f,0x0f,0x0f,0x1f,0x1f,0x0d,0x0f,0x0f,0x1f,0x1f,
+  0xff,0xff,0xff,0x1d,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3d,0x3f,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x0c,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x03,0x05,0x03,0x03,0x03,0x07,
+  0x00,0x07,0x0f,0x0d,0x07,0x07,0x07,0x0f,0x0f,0x1f,0x1f,0x1d,0x0f,0x0f,0x0f,0x1f,
+  0xff,0xff,0xff,0xfd,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfd,0x3f,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x0d,0x0e,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x05,0x05,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0d,0x0b,0x01,0x01,0x01,0x00,0x00,0x03,0x1d,0x17,0x03,0x03,0x03,
+  0x00,0x07,0x0f,0x3d,0x2f,0x07,0x07,0x07,0x0f,0x1f,0x1f,0x7d,0x5f,0x0f,0x0f,0x0f,
+  0xff,0xff,0xff,0xfd,0xff,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfd,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x0c,0x0f,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,0x0f,0x0f,0x08,0x00,
+  0x00,0x00,0x00,0x01,0x0f,0x0f,0x01,0x01,0x00,0x00,0x03,0x05,0x1f,0x1f,0x03,0x03,
+  0x00,0x07,0x0f,0x0d,0x3f,0x3f,0x07,0x07,0x0f,0x1f,0x1f,0x1d,0x7f,0x7f,0x0f,0x0f,
+  0xff,0xff,0xff,0xfd,0xff,0xff,0x1f,0x1f,0xff,0xff,0xff,0xfd,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xfd,0xff,0xff,0xff,0xff,0xf8,0xf8,0xff,0xfd,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xfd,0xff,0xff,0xff,0xff,0xe3,0xe3,0xff,0xfd,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xfd,0xff,0xff,0xff,0xff,0x8f,0x8f,0xff,0xfd,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,0xff,0xfd,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xfd,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfd,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xfd,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfd,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xfd,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfd,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfd,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x04,0x04,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+  0x00,0x00,0x01,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x0f,0x07,0x00,0x00,
+  0x00,0x07,0x07,0x05,0x1f,0x0f,0x0f,0x00,0x00,0x07,0x0f,0x0d,0x3f,0x1f,0x1f,0x0f,
+  0x0f,0x1f,0x1f,0x1d,0x7f,0x3f,0x3f,0x1f,0xff,0x3f,0x3f,0x3d,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x03,0x07,0x00,0x00,
+  0x00,0x00,0x03,0x05,0x07,0x0f,0x07,0x00,0x00,0x07,0x0f,0x0d,0x0f,0x1f,0x0f,0x0f,
+  0x0f,0x1f,0x1f,0x1d,0x1f,0x3f,0x1f,0x1f,0xff,0xff,0x3f,0x3d,0x3f,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x00,0x00,
+  0x00,0x00,0x03,0x05,0x07,0x07,0x07,0x00,0x00,0x07,0x0f,0x0d,0x0f,0x0f,0x0f,0x0f,
+  0x0f,0x1f,0x1f,0x1d,0x1f,0x1f,0x1f,0x1f,0xff,0xff,0xff,0x3d,0x3f,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x00,
+  0x00,0x00,0x03,0x05,0x07,0x07,0x07,0x00,0x00,0x07,0x0f,0x0d,0x0f,0x0f,0x0f,0x0f,
+  0x0f,0x1f,0x1f,0x1d,0x1f,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfd,0x3f,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x05,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x05,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x0b,0x03,0x03,0x00,
+  0x00,0x00,0x03,0x05,0x17,0x07,0x07,0x07,0x00,0x07,0x0f,0x0d,0x2f,0x0f,0x0f,0x0f,
+  0x0f,0x1f,0x1f,0x1d,0x5f,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfd,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x04,0x07,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0x07,0x01,0x01,0x00,0x00,0x00,0x01,0x03,0x0f,0x03,0x03,
+  0x00,0x00,0x03,0x05,0x07,0x1f,0x07,0x07,0x00,0x07,0x0f,0x0d,0x0f,0x3f,0x0f,0x0f,
+  0x0f,0x1f,0x1f,0x1d,0x5f,0x7f,0x1f,0x1f,0xff,0xff,0xff,0xfd,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xfb,0xff,0xff,0xff,0xff,0xf8,0xf8,0xff,0xfb,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xfb,0xff,0xff,0xff,0xff,0xe3,0xe3,0xff,0xfb,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xfb,0xff,0xff,0xff,0xff,0x8f,0x8f,0xff,0xfb,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,0xff,0xfb,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xfb,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfb,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xfb,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfb,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xfb,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfb,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfb,0xff,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xf8,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc3,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8b,0xff,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x1b,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3b,0xff,0xff,0xff,0xff,
+  0x00,0x3e,0x3c,0x38,0x3c,0x3f,0x3f,0x00,0x00,0x00,0x18,0x18,0x18,0x1e,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x0f,0x00,0x00,
+  0x00,0x0f,0x07,0x03,0x07,0x1f,0x1f,0x00,0x00,0x0f,0x0f,0x0b,0x0f,0x3f,0x3f,0x1f,
+  0x1f,0x3f,0x1f,0x1b,0x1f,0x7f,0x7f,0x3f,0xff,0xff,0x3f,0x3b,0x3f,0xff,0xff,0xff,
+  0x00,0x00,0x3c,0x38,0x3c,0x3c,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x07,0x03,0x07,0x07,0x0f,0x00,0x00,0x0f,0x1f,0x0b,0x0f,0x0f,0x1f,0x1f,
+  0x1f,0x3f,0x3f,0x1b,0x1f,0x1f,0x3f,0x3f,0xff,0xff,0xff,0x3b,0x3f,0x3f,0xff,0xff,
+  0x00,0x00,0x3c,0x3a,0x3c,0x3c,0x3c,0x3e,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,
+  0x00,0x00,0x07,0x0b,0x07,0x07,0x07,0x0f,0x00,0x0f,0x1f,0x1b,0x0f,0x0f,0x0f,0x1f,
+  0x1f,0x3f,0x3f,0x3b,0x1f,0x1f,0x1f,0x3f,0xff,0xff,0xff,0xfb,0x3f,0x3f,0x3f,0xff,
+  0x00,0x00,0x3c,0x3b,0x3e,0x3c,0x3c,0x3c,0x00,0x00,0x00,0x1b,0x1d,0x18,0x18,0x18,
+  0x00,0x00,0x00,0x0a,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x17,0x03,0x03,0x03,
+  0x00,0x00,0x07,0x3b,0x2f,0x07,0x07,0x07,0x00,0x0f,0x1f,0x7b,0x5f,0x0f,0x0f,0x0f,
+  0x1f,0x3f,0x3f,0xfb,0xbf,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfb,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x3c,0x3a,0x3f,0x3f,0x3c,0x3c,0x00,0x00,0x00,0x18,0x1f,0x1f,0x18,0x18,
+  0x00,0x00,0x00,0x00,0x1f,0x1f,0x11,0x00,0x00,0x00,0x00,0x03,0x1f,0x1f,0x03,0x03,
+  0x00,0x00,0x07,0x0b,0x3f,0x3f,0x07,0x07,0x00,0x0f,0x1f,0x1b,0x7f,0x7f,0x0f,0x0f,
+  0x1f,0x3f,0x3f,0x3b,0xff,0xff,0x1f,0x1f,0xff,0xff,0xff,0xfb,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xfb,0xff,0xff,0xff,0xff,0xf8,0xf8,0xff,0xfb,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xfb,0xff,0xff,0xff,0xff,0xe3,0xe3,0xff,0xfb,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xfb,0xff,0xff,0xff,0xff,0x8f,0x8f,0xff,0xfb,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,0xff,0xfb,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xfb,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xfb,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xfb,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xfb,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xfb,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xfb,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xfb,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x1c,0x18,0x1f,0x1e,0x00,0x00,0x00,0x00,0x08,0x08,0x0e,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x0e,0x00,0x00,0x00,
+  0x00,0x00,0x07,0x03,0x1f,0x0f,0x00,0x00,0x00,0x0f,0x0f,0x0b,0x3f,0x1f,0x1f,0x00,
+  0x00,0x0f,0x1f,0x1b,0x7f,0x3f,0x3f,0x1f,0x1f,0x3f,0x3f,0x3b,0xff,0x7f,0x7f,0x3f,
+  0x00,0x00,0x1c,0x18,0x1c,0x1e,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x00,
+  0x00,0x00,0x07,0x03,0x07,0x0f,0x00,0x00,0x00,0x00,0x07,0x0b,0x0f,0x1f,0x0f,0x00,
+  0x00,0x0f,0x1f,0x1b,0x1f,0x3f,0x1f,0x1f,0x1f,0x3f,0x3f,0x3b,0x3f,0x7f,0x3f,0x3f,
+  0x00,0x00,0x00,0x18,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x03,0x07,0x07,0x00,0x00,0x00,0x00,0x07,0x0b,0x0f,0x0f,0x0f,0x00,
+  0x00,0x0f,0x1f,0x1b,0x1f,0x1f,0x1f,0x1f,0x1f,0x3f,0x3f,0x3b,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x18,0x1c,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,
+  0x00,0x00,0x00,0x03,0x07,0x07,0x07,0x00,0x00,0x00,0x07,0x0b,0x0f,0x0f,0x0f,0x00,
+  0x00,0x0f,0x1f,0x1b,0x1f,0x1f,0x1f,0x1f,0x1f,0x3f,0x3f,0x3b,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x18,0x1d,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x0a,0x08,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x02,0x02,0x00,
+  0x00,0x00,0x00,0x03,0x17,0x07,0x07,0x00,0x00,0x00,0x07,0x0b,0x2f,0x0f,0x0f,0x0f,
+  0x00,0x0f,0x1f,0x1b,0x5f,0x1f,0x1f,0x1f,0x1f,0x3f,0x3f,0x3b,0xbf,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x18,0x1c,0x1f,0x1c,0x1c,0x00,0x00,0x00,0x00,0x08,0x0e,0x08,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x0e,0x02,0x02,
+  0x00,0x00,0x00,0x03,0x07,0x1f,0x07,0x07,0x00,0x00,0x07,0x0b,0x0f,0x3f,0x0f,0x0f,
+  0x00,0x0f,0x1f,0x1b,0x1f,0x7f,0x1f,0x1f,0x1f,0x3f,0x3f,0x3b,0xbf,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xf7,0xff,0xff,0xff,0xff,0xf8,0xf8,0xff,0xf7,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xf7,0xff,0xff,0xff,0xff,0xe3,0xe3,0xff,0xf7,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xf7,0xff,0xff,0xff,0xff,0x8f,0x8f,0xff,0xf7,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f,0xff,0xf7,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xf7,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xf7,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xf7,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xf7,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xf7,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xf7,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xf7,0xff,0xff,0xff,0xff,
+  0xff,0xfc,0xfc,0xf4,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf0,0xff,0xff,0xff,0xff,
+  0xff,0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xff,
+  0xff,0xc7,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x87,0xff,0xff,0xff,0xff,
+  0xff,0x1f,0x1f,0x17,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x37,0xff,0xff,0xff,0xff,
+  0x00,0xfc,0xfc,0xf4,0xfc,0xff,0xff,0xfe,0x00,0x7c,0x78,0x70,0x78,0x7e,0x7e,0x00,
+  0x00,0x00,0x30,0x30,0x30,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x06,0x06,0x06,0x1e,0x00,0x00,0x00,0x1f,0x0f,0x07,0x0f,0x3f,0x3f,0x00,
+  0x00,0x1f,0x1f,0x17,0x1f,0x7f,0x7f,0x3f,0x3f,0x7f,0x3f,0x37,0x3f,0xff,0xff,0x7f,
+  0x00,0xfc,0xfe,0xf4,0xfc,0xfc,0xfe,0xfe,0x00,0x00,0x78,0x70,0x78,0x78,0x7c,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x07,0x0f,0x0f,0x1f,0x00,
+  0x00,0x1f,0x3f,0x17,0x1f,0x1f,0x3f,0x3f,0x3f,0x7f,0x7f,0x37,0x3f,0x3f,0x7f,0x7f,
+  0x00,0xfc,0xfe,0xf6,0xfc,0xfc,0xfc,0xfe,0x00,0x00,0x78,0x74,0x78,0x78,0x78,0x7c,
+  0x00,0x00,0x00,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x06,0x06,0x06,0x06,0x00,0x00,0x00,0x0f,0x17,0x0f,0x0f,0x0f,0x1f,
+  0x00,0x1f,0x3f,0x37,0x1f,0x1f,0x1f,0x3f,0x3f,0x7f,0x7f,0x77,0x3f,0x3f,0x3f,0x7f,
+  0x00,0xfc,0xfe,0xf7,0xfe,0xfc,0xfc,0xfc,0x00,0x00,0x78,0x77,0x7d,0x78,0x78,0x78,
+  0x00,0x00,0x00,0x36,0x3a,0x30,0x30,0x30,0x00,0x00,0x00,0x14,0x14,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x36,0x2e,0x06,0x06,0x06,0x00,0x00,0x0f,0x77,0x5f,0x0f,0x0f,0x0f,
+  0x00,0x1f,0x3f,0xf7,0xbf,0x1f,0x1f,0x1f,0x3f,0x7f,0x7f,0xf7,0x7f,0x3f,0x3f,0x3f,
+  0x00,0xfc,0xfe,0xf6,0xff,0xff,0xfc,0xfc,0x00,0x00,0x78,0x74,0x7f,0x7f,0x78,0x78,
+  0x00,0x00,0x00,0x30,0x3e,0x3e,0x30,0x30,0x00,0x00,0x00,0x00,0x3e,0x3e,0x22,0x00,
+  0x00,0x00,0x00,0x06,0x3e,0x3e,0x06,0x06,0x00,0x00,0x0f,0x17,0x7f,0x7f,0x0f,0x0f,
+  0x00,0x1f,0x3f,0x37,0xff,0xff,0x1f,0x1f,0x3f,0x7f,0x7f,0x77,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xf7,0xff,0xff,0xff,0xff,0xf8,0xf8,0xff,0xf7,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xf7,0xff,0xff,0xff,0xff,0xe3,0xe3,0xff,0xf7,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xf7,0xff,0xff,0xff,0xff,0x8f,0x8f,0xff,0xf7,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xff,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f,0xff,0xf7,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xf7,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xf7,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xf7,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xf7,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xf7,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8f,0xf7,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x1f,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3f,0xf7,0xff,0xff,0xff,0xff,
+  0x00,0x7c,0x7c,0x74,0x7f,0x7e,0x7e,0x00,0x00,0x00,0x38,0x30,0x3e,0x3c,0x00,0x00,
+  0x00,0x00,0x10,0x10,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+  0x00,0x00,0x04,0x04,0x1c,0x00,0x00,0x00,0x00,0x00,0x0e,0x06,0x3e,0x1e,0x00,0x00,
+  0x00,0x1f,0x1f,0x17,0x7f,0x3f,0x3f,0x00,0x00,0x1f,0x3f,0x37,0xff,0x7f,0x7f,0x3f,
+  0x00,0x00,0x78,0x74,0x7c,0x7e,0x7c,0x00,0x00,0x00,0x38,0x30,0x38,0x3c,0x00,0x00,
+  0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x06,0x0e,0x1e,0x00,0x00,
+  0x00,0x00,0x0f,0x17,0x1f,0x3f,0x1f,0x00,0x00,0x1f,0x3f,0x37,0x3f,0x7f,0x3f,0x3f,
+  0x00,0x00,0x78,0x74,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x30,0x38,0x38,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x0e,0x0e,0x00,0x00,
+  0x00,0x00,0x0f,0x17,0x1f,0x1f,0x1f,0x00,0x00,0x1f,0x3f,0x37,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x78,0x74,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x30,0x38,0x38,0x38,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x06,0x0e,0x0e,0x0e,0x00,
+  0x00,0x00,0x0f,0x17,0x1f,0x1f,0x1f,0x00,0x00,0x1f,0x3f,0x37,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x78,0x74,0x7d,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x30,0x3a,0x38,0x38,0x00,
+  0x00,0x00,0x00,0x00,0x14,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x14,0x04,0x04,0x00,0x00,0x00,0x00,0x06,0x2e,0x0e,0x0e,0x00,
+  0x00,0x00,0x0f,0x17,0x5f,0x1f,0x1f,0x1f,0x00,0x1f,0x3f,0x37,0xbf,0x3f,0x3f,0x3f,
+  0x00,0x00,0x78,0x74,0x7c,0x7f,0x7c,0x7c,0x00,0x00,0x00,0x30,0x38,0x3e,0x38,0x38,
+  0x00,0x00,0x00,0x00,0x10,0x1c,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x04,0x1c,0x04,0x04,0x00,0x00,0x00,0x06,0x0e,0x3e,0x0e,0x0e,
+  0x00,0x00,0x0f,0x17,0x1f,0x7f,0x1f,0x1f,0x00,0x1f,0x3f,0x37,0x3f,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xfe,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xfe,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xfe,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xfe,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xfe,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0xfe,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xfe,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0xfe,0xff,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf0,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe2,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc6,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8e,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x1e,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3e,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x07,0x07,0x00,0x00,0x00,0x03,0x02,0x03,0x0f,0x0f,0x07,0x00,
+  0x00,0x07,0x06,0x07,0x1f,0x1f,0x0f,0x0f,0x00,0x0f,0x0e,0x0f,0x3f,0x3f,0x1f,0x1f,
+  0xff,0x1f,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0x3f,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x02,0x03,0x03,0x07,0x07,0x00,
+  0x00,0x00,0x06,0x07,0x07,0x0f,0x0f,0x0f,0x00,0x00,0x0e,0x0f,0x0f,0x1f,0x1f,0x1f,
+  0xff,0xff,0x1e,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3e,0x3f,0x3f,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x07,0x00,
+  0x00,0x00,0x00,0x07,0x07,0x07,0x0f,0x0f,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x1f,0x1f,
+  0xff,0xff,0xfe,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfe,0x3f,0x3f,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x00,
+  0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x0f,0x00,0x00,0x00,0x1f,0x0f,0x0f,0x0f,0x1f,
+  0xff,0xff,0xfe,0xff,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfe,0xff,0x3f,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,
+  0x00,0x00,0x00,0x00,0x0f,0x07,0x07,0x07,0x00,0x00,0x00,0x1f,0x1f,0x0f,0x0f,0x0f,
+  0xff,0xff,0xfe,0xff,0xff,0x1f,0x1f,0x1f,0xff,0xff,0xfe,0xff,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x03,0x03,
+  0x00,0x00,0x00,0x00,0x0f,0x0f,0x07,0x07,0x00,0x00,0x00,0x1f,0x1f,0x1f,0x0f,0x0f,
+  0xff,0xff,0xfe,0xff,0xff,0xff,0x1f,0x1f,0xff,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xfe,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xfe,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xfe,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xfe,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xfe,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0xfe,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xfe,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0xfe,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x07,0x03,0x00,0x00,0x00,0x00,0x02,0x02,0x0f,0x07,0x07,0x00,0x00,
+  0x00,0x07,0x06,0x1f,0x0f,0x0f,0x07,0x00,0x00,0x0f,0x0e,0x3f,0x1f,0x1f,0x0f,0x0f,
+  0x00,0x1f,0x1e,0x7f,0x3f,0x3f,0x1f,0x1f,0x3f,0x3f,0x3e,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x06,0x02,0x00,0x00,
+  0x00,0x00,0x06,0x07,0x0f,0x07,0x07,0x00,0x00,0x00,0x0e,0x0f,0x1f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x1e,0x1f,0x3f,0x1f,0x1f,0x1f,0xff,0x3f,0x3e,0x3f,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x00,0x00,
+  0x00,0x00,0x00,0x07,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x00,0x1f,0x1f,0x1f,0x1f,0x1f,0xff,0xff,0x3e,0x3f,0x3f,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x00,0x1f,0x1f,0x1f,0x1f,0x1f,0xff,0xff,0xfe,0x3f,0x3f,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x00,0x1f,0x1f,0x1f,0x1f,0x1f,0xff,0xff,0xfe,0xff,0x3f,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x00,0x1f,0x1f,0x1f,0x1f,0x1f,0xff,0xff,0xfe,0xff,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x00,0x1f,0x1f,0x1f,0x1f,0x1f,0xff,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xfd,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xfd,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xfd,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xfd,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xfd,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0xfd,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xfd,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0xfd,0xff,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe1,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc5,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8d,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x1d,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3d,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x0c,0x0c,0x0c,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0x01,0x01,0x07,0x00,0x00,0x00,0x07,0x03,0x01,0x03,0x0f,0x0f,0x00,0x00,
+  0x07,0x07,0x05,0x07,0x1f,0x1f,0x0f,0x00,0x1f,0x0f,0x0d,0x0f,0x3f,0x3f,0x1f,0x1f,
+  0x3f,0x1f,0x1d,0x1f,0x7f,0x7f,0x3f,0x3f,0xff,0x3f,0x3d,0x3f,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x03,0x03,0x07,0x00,0x00,
+  0x07,0x0f,0x05,0x07,0x07,0x0f,0x0f,0x00,0x1f,0x1f,0x0d,0x0f,0x0f,0x1f,0x1f,0x1f,
+  0x3f,0x3f,0x1d,0x1f,0x1f,0x3f,0x3f,0x3f,0xff,0xff,0x3d,0x3f,0x3f,0xff,0xff,0xff,
+  0x00,0x00,0x0c,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x03,0x05,0x03,0x03,0x03,0x07,0x00,
+  0x07,0x0f,0x0d,0x07,0x07,0x07,0x0f,0x00,0x1f,0x1f,0x1d,0x0f,0x0f,0x0f,0x1f,0x1f,
+  0x3f,0x3f,0x3d,0x1f,0x1f,0x1f,0x3f,0x3f,0xff,0xff,0xfd,0x3f,0x3f,0x3f,0xff,0xff,
+  0x00,0x00,0x0d,0x0e,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x05,0x05,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0d,0x0b,0x01,0x01,0x01,0x00,0x00,0x03,0x1d,0x17,0x03,0x03,0x03,0x00,
+  0x07,0x0f,0x3d,0x2f,0x07,0x07,0x07,0x0f,0x1f,0x1f,0x7d,0x5f,0x0f,0x0f,0x0f,0x1f,
+  0x3f,0x3f,0xfd,0xbf,0x1f,0x1f,0x1f,0x3f,0xff,0xff,0xfd,0xff,0x3f,0x3f,0x3f,0xff,
+  0x00,0x00,0x0c,0x0f,0x0f,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x0f,0x0f,0x08,0x00,0x00,
+  0x00,0x00,0x01,0x0f,0x0f,0x01,0x01,0x01,0x00,0x03,0x05,0x1f,0x1f,0x03,0x03,0x03,
+  0x07,0x0f,0x0d,0x3f,0x3f,0x07,0x07,0x07,0x1f,0x1f,0x1d,0x7f,0x7f,0x0f,0x0f,0x0f,
+  0x3f,0x3f,0x3d,0xff,0xff,0x1f,0x1f,0x1f,0xff,0xff,0xfd,0xff,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x1d,0x1f,0x1f,0x1f,0x1c,0x0c,0x00,0x00,0x1d,0x1f,0x1f,0x1f,0x18,0x00,
+  0x00,0x00,0x1d,0x1f,0x1f,0x1f,0x11,0x01,0x00,0x03,0x1d,0x1f,0x1f,0x1f,0x03,0x03,
+  0x07,0x0f,0x3d,0x3f,0x3f,0x3f,0x07,0x07,0x1f,0x1f,0x7d,0x7f,0x7f,0x7f,0x0f,0x0f,
+  0x3f,0x3f,0xfd,0xff,0xff,0xff,0x1f,0x1f,0xff,0xff,0xfd,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xfd,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xfd,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xfd,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xfd,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xfd,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0xfd,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xfd,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0xfd,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x04,0x04,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,
+  0x00,0x01,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x0f,0x07,0x00,0x00,0x00,
+  0x07,0x07,0x05,0x1f,0x0f,0x0f,0x00,0x00,0x07,0x0f,0x0d,0x3f,0x1f,0x1f,0x0f,0x00,
+  0x1f,0x1f,0x1d,0x7f,0x3f,0x3f,0x1f,0x1f,0x3f,0x3f,0x3d,0xff,0x7f,0x7f,0x3f,0x3f,
+  0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x03,0x07,0x00,0x00,0x00,
+  0x00,0x03,0x05,0x07,0x0f,0x07,0x00,0x00,0x07,0x0f,0x0d,0x0f,0x1f,0x0f,0x0f,0x00,
+  0x1f,0x1f,0x1d,0x1f,0x3f,0x1f,0x1f,0x1f,0x3f,0x3f,0x3d,0x3f,0x7f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x00,0x00,0x00,
+  0x00,0x03,0x05,0x07,0x07,0x07,0x00,0x00,0x07,0x0f,0x0d,0x0f,0x0f,0x0f,0x0f,0x00,
+  0x1f,0x1f,0x1d,0x1f,0x1f,0x1f,0x1f,0x1f,0x3f,0x3f,0x3d,0x3f,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x00,0x00,
+  0x00,0x03,0x05,0x07,0x07,0x07,0x00,0x00,0x07,0x0f,0x0d,0x0f,0x0f,0x0f,0x0f,0x00,
+  0x1f,0x1f,0x1d,0x1f,0x1f,0x1f,0x1f,0x1f,0x3f,0x3f,0x3d,0x3f,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x05,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x05,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x0b,0x03,0x03,0x00,0x00,
+  0x00,0x03,0x05,0x17,0x07,0x07,0x07,0x00,0x07,0x0f,0x0d,0x2f,0x0f,0x0f,0x0f,0x00,
+  0x1f,0x1f,0x1d,0x5f,0x1f,0x1f,0x1f,0x1f,0x3f,0x3f,0x3d,0xbf,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x04,0x07,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x07,0x01,0x01,0x00,0x00,0x00,0x01,0x03,0x0f,0x03,0x03,0x00,
+  0x00,0x03,0x05,0x07,0x1f,0x07,0x07,0x00,0x07,0x0f,0x0d,0x0f,0x3f,0x0f,0x0f,0x0f,
+  0x1f,0x1f,0x1d,0x1f,0x7f,0x1f,0x1f,0x1f,0x3f,0x3f,0x3d,0xbf,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x0f,0x0f,0x0f,0x04,0x04,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x00,0x00,
+  0x00,0x00,0x00,0x0f,0x0f,0x0f,0x01,0x01,0x00,0x00,0x01,0x0f,0x0f,0x0f,0x03,0x03,
+  0x00,0x03,0x05,0x1f,0x1f,0x1f,0x07,0x07,0x07,0x0f,0x0d,0x3f,0x3f,0x3f,0x0f,0x0f,
+  0x1f,0x1f,0x1d,0x7f,0x7f,0x7f,0x1f,0x1f,0x3f,0x3f,0x3d,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xfb,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xfb,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xfb,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xfb,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0xfb,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xfb,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0xfb,0xff,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xf8,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc3,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x8b,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x1b,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x3b,0xff,0xff,0xff,0xff,0xff,
+  0x3e,0x3c,0x38,0x3c,0x3f,0x3f,0x00,0x00,0x00,0x18,0x18,0x18,0x1e,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x0f,0x00,0x00,0x00,
+  0x0f,0x07,0x03,0x07,0x1f,0x1f,0x00,0x00,0x0f,0x0f,0x0b,0x0f,0x3f,0x3f,0x1f,0x00,
+  0x3f,0x1f,0x1b,0x1f,0x7f,0x7f,0x3f,0x3f,0x7f,0x3f,0x3b,0x3f,0xff,0xff,0x7f,0x7f,
+  0x00,0x3c,0x38,0x3c,0x3c,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x07,0x03,0x07,0x07,0x0f,0x00,0x00,0x0f,0x1f,0x0b,0x0f,0x0f,0x1f,0x1f,0x00,
+  0x3f,0x3f,0x1b,0x1f,0x1f,0x3f,0x3f,0x3f,0x7f,0x7f,0x3b,0x3f,0x3f,0x7f,0x7f,0x7f,
+  0x00,0x3c,0x3a,0x3c,0x3c,0x3c,0x3e,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,
+  0x00,0x07,0x0b,0x07,0x07,0x07,0x0f,0x00,0x0f,0x1f,0x1b,0x0f,0x0f,0x0f,0x1f,0x00,
+  0x3f,0x3f,0x3b,0x1f,0x1f,0x1f,0x3f,0x3f,0x7f,0x7f,0x7b,0x3f,0x3f,0x3f,0x7f,0x7f,
+  0x00,0x3c,0x3b,0x3e,0x3c,0x3c,0x3c,0x00,0x00,0x00,0x1b,0x1d,0x18,0x18,0x18,0x00,
+  0x00,0x00,0x0a,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x17,0x03,0x03,0x03,0x00,
+  0x00,0x07,0x3b,0x2f,0x07,0x07,0x07,0x00,0x0f,0x1f,0x7b,0x5f,0x0f,0x0f,0x0f,0x1f,
+  0x3f,0x3f,0xfb,0xbf,0x1f,0x1f,0x1f,0x3f,0x7f,0x7f,0xfb,0x7f,0x3f,0x3f,0x3f,0x7f,
+  0x00,0x3c,0x3a,0x3f,0x3f,0x3c,0x3c,0x3c,0x00,0x00,0x18,0x1f,0x1f,0x18,0x18,0x18,
+  0x00,0x00,0x00,0x1f,0x1f,0x11,0x00,0x00,0x00,0x00,0x03,0x1f,0x1f,0x03,0x03,0x03,
+  0x00,0x07,0x0b,0x3f,0x3f,0x07,0x07,0x07,0x0f,0x1f,0x1b,0x7f,0x7f,0x0f,0x0f,0x0f,
+  0x3f,0x3f,0x3b,0xff,0xff,0x1f,0x1f,0x1f,0x7f,0x7f,0x7b,0xff,0xff,0x3f,0x3f,0x3f,
+  0x00,0x3c,0x3b,0x3f,0x3f,0x3f,0x3c,0x3c,0x00,0x00,0x3b,0x3f,0x3f,0x3f,0x38,0x18,
+  0x00,0x00,0x3b,0x3f,0x3f,0x3f,0x31,0x00,0x00,0x00,0x3b,0x3f,0x3f,0x3f,0x23,0x03,
+  0x00,0x07,0x3b,0x3f,0x3f,0x3f,0x07,0x07,0x0f,0x1f,0x7b,0x7f,0x7f,0x7f,0x0f,0x0f,
+  0x3f,0x3f,0xfb,0xff,0xff,0xff,0x1f,0x1f,0x7f,0x7f,0xfb,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xfb,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xfb,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xfb,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xfb,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0xfb,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xfb,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0xfb,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x1c,0x18,0x1f,0x1e,0x00,0x00,0x00,0x00,0x08,0x08,0x0e,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x0e,0x00,0x00,0x00,0x00,
+  0x00,0x07,0x03,0x1f,0x0f,0x00,0x00,0x00,0x0f,0x0f,0x0b,0x3f,0x1f,0x1f,0x00,0x00,
+  0x0f,0x1f,0x1b,0x7f,0x3f,0x3f,0x1f,0x00,0x3f,0x3f,0x3b,0xff,0x7f,0x7f,0x3f,0x3f,
+  0x00,0x1c,0x18,0x1c,0x1e,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x00,0x00,
+  0x00,0x07,0x03,0x07,0x0f,0x00,0x00,0x00,0x00,0x07,0x0b,0x0f,0x1f,0x0f,0x00,0x00,
+  0x0f,0x1f,0x1b,0x1f,0x3f,0x1f,0x1f,0x00,0x3f,0x3f,0x3b,0x3f,0x7f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x18,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x03,0x07,0x07,0x00,0x00,0x00,0x00,0x07,0x0b,0x0f,0x0f,0x0f,0x00,0x00,
+  0x0f,0x1f,0x1b,0x1f,0x1f,0x1f,0x1f,0x00,0x3f,0x3f,0x3b,0x3f,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x18,0x1c,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x00,
+  0x00,0x00,0x03,0x07,0x07,0x07,0x00,0x00,0x00,0x07,0x0b,0x0f,0x0f,0x0f,0x00,0x00,
+  0x0f,0x1f,0x1b,0x1f,0x1f,0x1f,0x1f,0x00,0x3f,0x3f,0x3b,0x3f,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x18,0x1d,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x0a,0x08,0x08,0x00,0x00,
+  0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x02,0x02,0x00,0x00,
+  0x00,0x00,0x03,0x17,0x07,0x07,0x00,0x00,0x00,0x07,0x0b,0x2f,0x0f,0x0f,0x0f,0x00,
+  0x0f,0x1f,0x1b,0x5f,0x1f,0x1f,0x1f,0x00,0x3f,0x3f,0x3b,0xbf,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x18,0x1c,0x1f,0x1c,0x1c,0x00,0x00,0x00,0x00,0x08,0x0e,0x08,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x0e,0x02,0x02,0x00,
+  0x00,0x00,0x03,0x07,0x1f,0x07,0x07,0x00,0x00,0x07,0x0b,0x0f,0x3f,0x0f,0x0f,0x00,
+  0x0f,0x1f,0x1b,0x1f,0x7f,0x1f,0x1f,0x1f,0x3f,0x3f,0x3b,0x3f,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x18,0x1f,0x1f,0x1f,0x1c,0x1c,0x00,0x00,0x00,0x1f,0x1f,0x1f,0x08,0x08,
+  0x00,0x00,0x00,0x1f,0x1f,0x1f,0x00,0x00,0x00,0x00,0x00,0x1f,0x1f,0x1f,0x02,0x02,
+  0x00,0x00,0x03,0x1f,0x1f,0x1f,0x07,0x07,0x00,0x07,0x0b,0x3f,0x3f,0x3f,0x0f,0x0f,
+  0x0f,0x1f,0x1b,0x7f,0x7f,0x7f,0x1f,0x1f,0x3f,0x3f,0x3b,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xf7,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf7,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf7,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xf7,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xf7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0xf7,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xf7,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0xf7,0xff,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xf4,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf0,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0x87,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0x17,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x37,0xff,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xf4,0xfc,0xff,0xff,0xfe,0x00,0x7c,0x78,0x70,0x78,0x7e,0x7e,0x00,0x00,
+  0x00,0x30,0x30,0x30,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x06,0x06,0x06,0x1e,0x00,0x00,0x00,0x1f,0x0f,0x07,0x0f,0x3f,0x3f,0x00,0x00,
+  0x1f,0x1f,0x17,0x1f,0x7f,0x7f,0x3f,0x00,0x7f,0x3f,0x37,0x3f,0xff,0xff,0x7f,0x7f,
+  0xfc,0xfe,0xf4,0xfc,0xfc,0xfe,0xfe,0x00,0x00,0x78,0x70,0x78,0x78,0x7c,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x07,0x0f,0x0f,0x1f,0x00,0x00,
+  0x1f,0x3f,0x17,0x1f,0x1f,0x3f,0x3f,0x00,0x7f,0x7f,0x37,0x3f,0x3f,0x7f,0x7f,0x7f,
+  0xfc,0xfe,0xf6,0xfc,0xfc,0xfc,0xfe,0x00,0x00,0x78,0x74,0x78,0x78,0x78,0x7c,0x00,
+  0x00,0x00,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x06,0x06,0x06,0x06,0x00,0x00,0x00,0x0f,0x17,0x0f,0x0f,0x0f,0x1f,0x00,
+  0x1f,0x3f,0x37,0x1f,0x1f,0x1f,0x3f,0x00,0x7f,0x7f,0x77,0x3f,0x3f,0x3f,0x7f,0x7f,
+  0xfc,0xfe,0xf7,0xfe,0xfc,0xfc,0xfc,0xfe,0x00,0x78,0x77,0x7d,0x78,0x78,0x78,0x00,
+  0x00,0x00,0x36,0x3a,0x30,0x30,0x30,0x00,0x00,0x00,0x14,0x14,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x36,0x2e,0x06,0x06,0x06,0x00,0x00,0x0f,0x77,0x5f,0x0f,0x0f,0x0f,0x00,
+  0x1f,0x3f,0xf7,0xbf,0x1f,0x1f,0x1f,0x3f,0x7f,0x7f,0xf7,0x7f,0x3f,0x3f,0x3f,0x7f,
+  0xfc,0xfe,0xf6,0xff,0xff,0xfc,0xfc,0xfc,0x00,0x78,0x74,0x7f,0x7f,0x78,0x78,0x78,
+  0x00,0x00,0x30,0x3e,0x3e,0x30,0x30,0x30,0x00,0x00,0x00,0x3e,0x3e,0x22,0x00,0x00,
+  0x00,0x00,0x06,0x3e,0x3e,0x06,0x06,0x06,0x00,0x0f,0x17,0x7f,0x7f,0x0f,0x0f,0x0f,
+  0x1f,0x3f,0x37,0xff,0xff,0x1f,0x1f,0x1f,0x7f,0x7f,0x77,0xff,0xff,0x3f,0x3f,0x3f,
+  0xfc,0xfe,0xf7,0xff,0xff,0xff,0xfc,0xfc,0x00,0x78,0x77,0x7f,0x7f,0x7f,0x78,0x78,
+  0x00,0x00,0x77,0x7f,0x7f,0x7f,0x71,0x30,0x00,0x00,0x77,0x7f,0x7f,0x7f,0x63,0x00,
+  0x00,0x00,0x77,0x7f,0x7f,0x7f,0x47,0x06,0x00,0x0f,0x77,0x7f,0x7f,0x7f,0x0f,0x0f,
+  0x1f,0x3f,0xf7,0xff,0xff,0xff,0x1f,0x1f,0x7f,0x7f,0xf7,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xf7,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf7,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf7,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xf7,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xf7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8f,0xf7,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1f,0xf7,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0xf7,0xff,0xff,0xff,0xff,0xff,
+  0x7c,0x7c,0x74,0x7f,0x7e,0x7e,0x00,0x00,0x00,0x38,0x30,0x3e,0x3c,0x00,0x00,0x00,
+  0x00,0x10,0x10,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x1c,0x00,0x00,0x00,0x00,0x00,0x0e,0x06,0x3e,0x1e,0x00,0x00,0x00,
+  0x1f,0x1f,0x17,0x7f,0x3f,0x3f,0x00,0x00,0x1f,0x3f,0x37,0xff,0x7f,0x7f,0x3f,0x00,
+  0x00,0x78,0x74,0x7c,0x7e,0x7c,0x00,0x00,0x00,0x38,0x30,0x38,0x3c,0x00,0x00,0x00,
+  0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x06,0x0e,0x1e,0x00,0x00,0x00,
+  0x00,0x0f,0x17,0x1f,0x3f,0x1f,0x00,0x00,0x1f,0x3f,0x37,0x3f,0x7f,0x3f,0x3f,0x00,
+  0x00,0x78,0x74,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x30,0x38,0x38,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x0e,0x0e,0x00,0x00,0x00,
+  0x00,0x0f,0x17,0x1f,0x1f,0x1f,0x00,0x00,0x1f,0x3f,0x37,0x3f,0x3f,0x3f,0x3f,0x00,
+  0x00,0x78,0x74,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x30,0x38,0x38,0x38,0x00,0x00,
+  0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x06,0x0e,0x0e,0x0e,0x00,0x00,
+  0x00,0x0f,0x17,0x1f,0x1f,0x1f,0x00,0x00,0x1f,0x3f,0x37,0x3f,0x3f,0x3f,0x3f,0x00,
+  0x00,0x78,0x74,0x7d,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x30,0x3a,0x38,0x38,0x00,0x00,
+  0x00,0x00,0x00,0x14,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x14,0x04,0x04,0x00,0x00,0x00,0x00,0x06,0x2e,0x0e,0x0e,0x00,0x00,
+  0x00,0x0f,0x17,0x5f,0x1f,0x1f,0x1f,0x00,0x1f,0x3f,0x37,0xbf,0x3f,0x3f,0x3f,0x00,
+  0x00,0x78,0x74,0x7c,0x7f,0x7c,0x7c,0x00,0x00,0x00,0x30,0x38,0x3e,0x38,0x38,0x00,
+  0x00,0x00,0x00,0x10,0x1c,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x04,0x1c,0x04,0x04,0x00,0x00,0x00,0x06,0x0e,0x3e,0x0e,0x0e,0x00,
+  0x00,0x0f,0x17,0x1f,0x7f,0x1f,0x1f,0x00,0x1f,0x3f,0x37,0x3f,0xff,0x3f,0x3f,0x3f,
+  0x00,0x78,0x74,0x7f,0x7f,0x7f,0x7c,0x7c,0x00,0x00,0x30,0x3e,0x3e,0x3e,0x38,0x38,
+  0x00,0x00,0x00,0x3e,0x3e,0x3e,0x10,0x10,0x00,0x00,0x00,0x3e,0x3e,0x3e,0x00,0x00,
+  0x00,0x00,0x00,0x3e,0x3e,0x3e,0x04,0x04,0x00,0x00,0x06,0x3e,0x3e,0x3e,0x0e,0x0e,
+  0x00,0x0f,0x17,0x7f,0x7f,0x7f,0x1f,0x1f,0x1f,0x3f,0x37,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,0xe2,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0x8f,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1e,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf0,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe2,0xe3,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc6,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8e,0x8f,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1e,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0x3f,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x0f,0x0f,0x00,0x00,0x00,0x02,0x03,0x03,0x1f,0x1f,0x07,0x00,
+  0x00,0x06,0x07,0x07,0x3f,0x3f,0x0f,0x0f,0x00,0x0e,0x0f,0x0f,0x7f,0x7f,0x1f,0x1f,
+  0xff,0x1e,0x1f,0x1f,0xff,0xff,0xff,0xff,0xff,0x3e,0x3f,0x3f,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x07,0x07,0x00,
+  0x00,0x00,0x07,0x07,0x07,0x0f,0x0f,0x0f,0x00,0x00,0x0f,0x0f,0x0f,0x1f,0x1f,0x1f,
+  0xff,0xfe,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xff,0xfe,0x3f,0x3f,0x3f,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x07,0x00,
+  0x00,0x00,0x00,0x07,0x07,0x07,0x0f,0x0f,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x1f,0x1f,
+  0xff,0xfe,0xff,0x1f,0x1f,0x1f,0xff,0xff,0xff,0xfe,0xff,0x3f,0x3f,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x00,
+  0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x0f,0x00,0x00,0x00,0x1f,0x0f,0x0f,0x0f,0x1f,
+  0xff,0xfe,0xff,0xff,0x1f,0x1f,0x1f,0xff,0xff,0xfe,0xff,0xff,0x3f,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,
+  0x00,0x00,0x00,0x00,0x0f,0x07,0x07,0x07,0x00,0x00,0x00,0x1f,0x1f,0x0f,0x0f,0x0f,
+  0xff,0xfe,0xff,0xff,0xff,0x1f,0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x03,0x03,
+  0x00,0x00,0x00,0x00,0x0f,0x0f,0x07,0x07,0x00,0x00,0x00,0x1f,0x1f,0x1f,0x0f,0x0f,
+  0xff,0xfe,0xff,0xff,0xff,0xff,0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,
+  0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+  0xf1,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,0xe2,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0x8f,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1e,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0x3e,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x02,0x02,0x0f,0x0f,0x0f,0x00,0x00,
+  0x00,0x06,0x07,0x1f,0x1f,0x1f,0x07,0x00,0x00,0x0e,0x0f,0x3f,0x3f,0x3f,0x0f,0x0f,
+  0x00,0x1e,0x1f,0x7f,0x7f,0x7f,0x1f,0x1f,0x3f,0x3e,0x3f,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x0e,0x02,0x00,0x00,
+  0x00,0x00,0x07,0x07,0x1f,0x07,0x07,0x00,0x00,0x00,0x0f,0x0f,0x3f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x1f,0x1f,0x7f,0x1f,0x1f,0x1f,0xff,0x3e,0x3f,0x3f,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x00,0x00,
+  0x00,0x00,0x00,0x07,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x00,0x1f,0x1f,0x1f,0x1f,0x1f,0xff,0xfe,0x3f,0x3f,0x3f,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x00,0x1f,0x1f,0x1f,0x1f,0x1f,0xff,0xfe,0xff,0x3f,0x3f,0x3f,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x00,0x1f,0x1f,0x1f,0x1f,0x1f,0xff,0xfe,0xff,0xff,0x3f,0x3f,0x3f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x00,0x1f,0x1f,0x1f,0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,
+  0x00,0x00,0x00,0x1f,0x1f,0x1f,0x1f,0x1f,0xff,0xfe,0xff,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,0x8f,0x8d,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1d,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xfc,0xfc,0xfc,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xe3,0xe1,0xe3,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc5,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8d,0x8f,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1d,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3d,0x3f,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x03,0x03,0x1f,0x1f,0x00,0x00,
+  0x0f,0x05,0x07,0x07,0x3f,0x3f,0x0f,0x00,0x1f,0x0d,0x0f,0x0f,0x7f,0x7f,0x1f,0x1f,
+  0x3f,0x1d,0x1f,0x1f,0xff,0xff,0x3f,0x3f,0xff,0x3d,0x3f,0x3f,0xff,0xff,0xff,0xff,
+  0x00,0x0c,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x03,0x05,0x03,0x03,0x03,0x07,0x00,0x00,
+  0x0f,0x0d,0x07,0x07,0x07,0x0f,0x0f,0x00,0x1f,0x1d,0x0f,0x0f,0x0f,0x1f,0x1f,0x1f,
+  0x3f,0x3d,0x1f,0x1f,0x1f,0x3f,0x3f,0x3f,0xff,0xfd,0x3f,0x3f,0x3f,0xff,0xff,0xff,
+  0x00,0x0d,0x0e,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x05,0x05,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0d,0x0b,0x01,0x01,0x01,0x00,0x00,0x03,0x1d,0x17,0x03,0x03,0x03,0x00,0x00,
+  0x0f,0x3d,0x2f,0x07,0x07,0x07,0x0f,0x00,0x1f,0x7d,0x5f,0x0f,0x0f,0x0f,0x1f,0x1f,
+  0x3f,0xfd,0xbf,0x1f,0x1f,0x1f,0x3f,0x3f,0xff,0xfd,0xff,0x3f,0x3f,0x3f,0xff,0xff,
+  0x00,0x0c,0x0f,0x0f,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x0f,0x0f,0x08,0x00,0x00,0x00,
+  0x00,0x01,0x0f,0x0f,0x01,0x01,0x01,0x00,0x03,0x05,0x1f,0x1f,0x03,0x03,0x03,0x00,
+  0x0f,0x0d,0x3f,0x3f,0x07,0x07,0x07,0x00,0x1f,0x1d,0x7f,0x7f,0x0f,0x0f,0x0f,0x1f,
+  0x3f,0x3d,0xff,0xff,0x1f,0x1f,0x1f,0x3f,0xff,0xfd,0xff,0xff,0x3f,0x3f,0x3f,0xff,
+  0x00,0x1d,0x1f,0x1f,0x1f,0x1c,0x0c,0x0c,0x00,0x1d,0x1f,0x1f,0x1f,0x18,0x00,0x00,
+  0x00,0x1d,0x1f,0x1f,0x1f,0x11,0x01,0x01,0x03,0x1d,0x1f,0x1f,0x1f,0x03,0x03,0x03,
+  0x0f,0x3d,0x3f,0x3f,0x3f,0x07,0x07,0x07,0x1f,0x7d,0x7f,0x7f,0x7f,0x0f,0x0f,0x0f,
+  0x3f,0xfd,0xff,0xff,0xff,0x1f,0x1f,0x1f,0xff,0xfd,0xff,0xff,0xff,0x3f,0x3f,0x3f,
+  0x3f,0x3d,0x3f,0x3f,0x3f,0x3f,0x3c,0x0c,0x3f,0x3d,0x3f,0x3f,0x3f,0x3f,0x38,0x00,
+  0x3f,0x3d,0x3f,0x3f,0x3f,0x3f,0x31,0x01,0x3f,0x3d,0x3f,0x3f,0x3f,0x3f,0x23,0x03,
+  0x3f,0x3d,0x3f,0x3f,0x3f,0x3f,0x07,0x07,0x7f,0x7d,0x7f,0x7f,0x7f,0x7f,0x0f,0x0f,
+  0xff,0xfd,0xff,0xff,0xff,0xff,0x1f,0x1f,0xff,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,
+  0x04,0x04,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+  0x01,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0xe3,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,0x8f,0x8d,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1d,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x01,0x03,0x1f,0x1f,0x1f,0x00,0x00,
+  0x03,0x05,0x07,0x1f,0x1f,0x1f,0x00,0x00,0x0f,0x0d,0x0f,0x3f,0x3f,0x3f,0x0f,0x00,
+  0x1f,0x1d,0x1f,0x7f,0x7f,0x7f,0x1f,0x1f,0x3f,0x3d,0x3f,0xff,0xff,0xff,0x3f,0x3f,
+  0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x0f,0x00,0x00,0x00,
+  0x03,0x05,0x07,0x07,0x1f,0x07,0x00,0x00,0x0f,0x0d,0x0f,0x0f,0x3f,0x0f,0x0f,0x00,
+  0x1f,0x1d,0x1f,0x1f,0x7f,0x1f,0x1f,0x1f,0x3f,0x3d,0x3f,0x3f,0xff,0x3f,0x3f,0x3f,
+  0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x00,0x00,0x00,
+  0x03,0x05,0x07,0x07,0x07,0x07,0x00,0x00,0x0f,0x0d,0x0f,0x0f,0x0f,0x0f,0x0f,0x00,
+  0x1f,0x1d,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x3f,0x3d,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x05,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x05,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x0b,0x03,0x03,0x00,0x00,0x00,
+  0x03,0x05,0x17,0x07,0x07,0x07,0x00,0x00,0x0f,0x0d,0x2f,0x0f,0x0f,0x0f,0x0f,0x00,
+  0x1f,0x1d,0x5f,0x1f,0x1f,0x1f,0x1f,0x1f,0x3f,0x3d,0xbf,0x3f,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x04,0x07,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0x07,0x01,0x01,0x00,0x00,0x00,0x01,0x03,0x0f,0x03,0x03,0x00,0x00,
+  0x03,0x05,0x07,0x1f,0x07,0x07,0x00,0x00,0x0f,0x0d,0x0f,0x3f,0x0f,0x0f,0x0f,0x00,
+  0x1f,0x1d,0x1f,0x7f,0x1f,0x1f,0x1f,0x1f,0x3f,0x3d,0xbf,0xff,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x00,0x0f,0x0f,0x0f,0x04,0x04,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x00,0x00,0x00,
+  0x00,0x00,0x0f,0x0f,0x0f,0x01,0x01,0x00,0x00,0x01,0x0f,0x0f,0x0f,0x03,0x03,0x00,
+  0x03,0x05,0x1f,0x1f,0x1f,0x07,0x07,0x00,0x0f,0x0d,0x3f,0x3f,0x3f,0x0f,0x0f,0x00,
+  0x1f,0x1d,0x7f,0x7f,0x7f,0x1f,0x1f,0x1f,0x3f,0x3d,0xff,0xff,0xff,0x3f,0x3f,0x3f,
+  0x00,0x1d,0x1f,0x1f,0x1f,0x1f,0x04,0x04,0x00,0x1d,0x1f,0x1f,0x1f,0x1f,0x00,0x00,
+  0x00,0x1d,0x1f,0x1f,0x1f,0x1f,0x01,0x01,0x00,0x1d,0x1f,0x1f,0x1f,0x1f,0x03,0x03,
+  0x03,0x1d,0x1f,0x1f,0x1f,0x1f,0x07,0x07,0x0f,0x3d,0x3f,0x3f,0x3f,0x3f,0x0f,0x0f,
+  0x1f,0x7d,0x7f,0x7f,0x7f,0x7f,0x1f,0x1f,0x3f,0xfd,0xff,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc3,0xff,0xff,0xff,0xff,0xff,0xff,0x8f,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0x3b,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xfc,0xf8,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf8,0xf8,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe3,0xe3,0xe3,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc3,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x8b,0x8f,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1b,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x3b,0x3f,0xff,0xff,0xff,0xff,0xff,
+  0x3c,0x38,0x3c,0x3c,0x3f,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x07,0x03,0x07,0x07,0x3f,0x3f,0x00,0x00,0x1f,0x0b,0x0f,0x0f,0x7f,0x7f,0x1f,0x00,
+  0x3f,0x1b,0x1f,0x1f,0xff,0xff,0x3f,0x3f,0x7f,0x3b,0x3f,0x3f,0xff,0xff,0x7f,0x7f,
+  0x3c,0x3a,0x3c,0x3c,0x3c,0x3e,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,0x00,
+  0x07,0x0b,0x07,0x07,0x07,0x0f,0x00,0x00,0x1f,0x1b,0x0f,0x0f,0x0f,0x1f,0x1f,0x00,
+  0x3f,0x3b,0x1f,0x1f,0x1f,0x3f,0x3f,0x3f,0x7f,0x7b,0x3f,0x3f,0x3f,0x7f,0x7f,0x7f,
+  0x3c,0x3b,0x3e,0x3c,0x3c,0x3c,0x00,0x00,0x00,0x1b,0x1d,0x18,0x18,0x18,0x00,0x00,
+  0x00,0x0a,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x17,0x03,0x03,0x03,0x00,0x00,
+  0x07,0x3b,0x2f,0x07,0x07,0x07,0x00,0x00,0x1f,0x7b,0x5f,0x0f,0x0f,0x0f,0x1f,0x00,
+  0x3f,0xfb,0xbf,0x1f,0x1f,0x1f,0x3f,0x3f,0x7f,0xfb,0x7f,0x3f,0x3f,0x3f,0x7f,0x7f,
+  0x3c,0x3a,0x3f,0x3f,0x3c,0x3c,0x3c,0x00,0x00,0x18,0x1f,0x1f,0x18,0x18,0x18,0x00,
+  0x00,0x00,0x1f,0x1f,0x11,0x00,0x00,0x00,0x00,0x03,0x1f,0x1f,0x03,0x03,0x03,0x00,
+  0x07,0x0b,0x3f,0x3f,0x07,0x07,0x07,0x00,0x1f,0x1b,0x7f,0x7f,0x0f,0x0f,0x0f,0x00,
+  0x3f,0x3b,0xff,0xff,0x1f,0x1f,0x1f,0x3f,0x7f,0x7b,0xff,0xff,0x3f,0x3f,0x3f,0x7f,
+  0x3c,0x3b,0x3f,0x3f,0x3f,0x3c,0x3c,0x3c,0x00,0x3b,0x3f,0x3f,0x3f,0x38,0x18,0x18,
+  0x00,0x3b,0x3f,0x3f,0x3f,0x31,0x00,0x00,0x00,0x3b,0x3f,0x3f,0x3f,0x23,0x03,0x03,
+  0x07,0x3b,0x3f,0x3f,0x3f,0x07,0x07,0x07,0x1f,0x7b,0x7f,0x7f,0x7f,0x0f,0x0f,0x0f,
+  0x3f,0xfb,0xff,0xff,0xff,0x1f,0x1f,0x1f,0x7f,0xfb,0xff,0xff,0xff,0x3f,0x3f,0x3f,
+  0x7f,0x7b,0x7f,0x7f,0x7f,0x7f,0x7c,0x3c,0x7f,0x7b,0x7f,0x7f,0x7f,0x7f,0x78,0x18,
+  0x7f,0x7b,0x7f,0x7f,0x7f,0x7f,0x71,0x00,0x7f,0x7b,0x7f,0x7f,0x7f,0x7f,0x63,0x03,
+  0x7f,0x7b,0x7f,0x7f,0x7f,0x7f,0x47,0x07,0x7f,0x7b,0x7f,0x7f,0x7f,0x7f,0x0f,0x0f,
+  0xff,0xfb,0xff,0xff,0xff,0xff,0x1f,0x1f,0xff,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x08,0x08,0x0e,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x0e,0x00,0x00,0x00,0x00,0x00,
+  0xc7,0xc3,0xff,0xff,0xff,0xff,0xff,0xff,0x8f,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0x3b,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x3c,0x38,0x3c,0x3f,0x3f,0x3f,0x00,0x00,0x00,0x08,0x08,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x00,0x00,0x00,
+  0x07,0x03,0x07,0x3f,0x3f,0x3f,0x00,0x00,0x07,0x0b,0x0f,0x3f,0x3f,0x3f,0x00,0x00,
+  0x1f,0x1b,0x1f,0x7f,0x7f,0x7f,0x1f,0x00,0x3f,0x3b,0x3f,0xff,0xff,0xff,0x3f,0x3f,
+  0x00,0x18,0x1c,0x1c,0x1f,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x03,0x07,0x07,0x1f,0x00,0x00,0x00,0x07,0x0b,0x0f,0x0f,0x3f,0x0f,0x00,0x00,
+  0x1f,0x1b,0x1f,0x1f,0x7f,0x1f,0x1f,0x00,0x3f,0x3b,0x3f,0x3f,0xff,0x3f,0x3f,0x3f,
+  0x00,0x18,0x1c,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x00,0x00,
+  0x00,0x03,0x07,0x07,0x07,0x00,0x00,0x00,0x07,0x0b,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
+  0x1f,0x1b,0x1f,0x1f,0x1f,0x1f,0x1f,0x00,0x3f,0x3b,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x18,0x1d,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x0a,0x08,0x08,0x00,0x00,0x00,
+  0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x02,0x02,0x00,0x00,0x00,
+  0x00,0x03,0x17,0x07,0x07,0x00,0x00,0x00,0x07,0x0b,0x2f,0x0f,0x0f,0x0f,0x00,0x00,
+  0x1f,0x1b,0x5f,0x1f,0x1f,0x1f,0x1f,0x00,0x3f,0x3b,0xbf,0x3f,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x18,0x1c,0x1f,0x1c,0x1c,0x00,0x00,0x00,0x00,0x08,0x0e,0x08,0x08,0x00,0x00,
+  0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x0e,0x02,0x02,0x00,0x00,
+  0x00,0x03,0x07,0x1f,0x07,0x07,0x00,0x00,0x07,0x0b,0x0f,0x3f,0x0f,0x0f,0x00,0x00,
+  0x1f,0x1b,0x1f,0x7f,0x1f,0x1f,0x1f,0x00,0x3f,0x3b,0x3f,0xff,0x3f,0x3f,0x3f,0x3f,
+  0x00,0x18,0x1f,0x1f,0x1f,0x1c,0x1c,0x00,0x00,0x00,0x1f,0x1f,0x1f,0x08,0x08,0x00,
+  0x00,0x00,0x1f,0x1f,0x1f,0x00,0x00,0x00,0x00,0x00,0x1f,0x1f,0x1f,0x02,0x02,0x00,
+  0x00,0x03,0x1f,0x1f,0x1f,0x07,0x07,0x00,0x07,0x0b,0x3f,0x3f,0x3f,0x0f,0x0f,0x00,
+  0x1f,0x1b,0x7f,0x7f,0x7f,0x1f,0x1f,0x00,0x3f,0x3b,0xff,0xff,0xff,0x3f,0x3f,0x3f,
+  0x00,0x3b,0x3f,0x3f,0x3f,0x3f,0x1c,0x1c,0x00,0x3b,0x3f,0x3f,0x3f,0x3f,0x08,0x08,
+  0x00,0x3b,0x3f,0x3f,0x3f,0x3f,0x00,0x00,0x00,0x3b,0x3f,0x3f,0x3f,0x3f,0x02,0x02,
+  0x00,0x3b,0x3f,0x3f,0x3f,0x3f,0x07,0x07,0x07,0x3b,0x3f,0x3f,0x3f,0x3f,0x0f,0x0f,
+  0x1f,0x7b,0x7f,0x7f,0x7f,0x7f,0x1f,0x1f,0x3f,0xfb,0xff,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xf4,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0x8f,0x87,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0x37,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xfc,0xf4,0xfc,0xff,0xff,0xff,0xff,0xff,0xf8,0xf0,0xf8,0xff,0xff,0xff,0xff,0xff,
+  0xf1,0xf1,0xf1,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xc7,0xc7,0xc7,0xff,0xff,0xff,0xff,0xff,0x8f,0x87,0x8f,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x17,0x1f,0xff,0xff,0xff,0xff,0xff,0x3f,0x37,0x3f,0xff,0xff,0xff,0xff,0xff,
+  0xfe,0xf4,0xfc,0xfc,0xff,0xff,0xfe,0x00,0x78,0x70,0x78,0x78,0x7f,0x7f,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x07,0x0f,0x0f,0x7f,0x7f,0x00,0x00,
+  0x3f,0x17,0x1f,0x1f,0xff,0xff,0x3f,0x00,0x7f,0x37,0x3f,0x3f,0xff,0xff,0x7f,0x7f,
+  0xfe,0xf6,0xfc,0xfc,0xfc,0xfe,0xfe,0x00,0x78,0x74,0x78,0x78,0x78,0x7c,0x00,0x00,
+  0x00,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x06,0x06,0x06,0x06,0x00,0x00,0x00,0x0f,0x17,0x0f,0x0f,0x0f,0x1f,0x00,0x00,
+  0x3f,0x37,0x1f,0x1f,0x1f,0x3f,0x3f,0x00,0x7f,0x77,0x3f,0x3f,0x3f,0x7f,0x7f,0x7f,
+  0xfe,0xf7,0xfe,0xfc,0xfc,0xfc,0xfe,0x00,0x78,0x77,0x7d,0x78,0x78,0x78,0x00,0x00,
+  0x00,0x36,0x3a,0x30,0x30,0x30,0x00,0x00,0x00,0x14,0x14,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x36,0x2e,0x06,0x06,0x06,0x00,0x00,0x0f,0x77,0x5f,0x0f,0x0f,0x0f,0x00,0x00,
+  0x3f,0xf7,0xbf,0x1f,0x1f,0x1f,0x3f,0x00,0x7f,0xf7,0x7f,0x3f,0x3f,0x3f,0x7f,0x7f,
+  0xfe,0xf6,0xff,0xff,0xfc,0xfc,0xfc,0x00,0x78,0x74,0x7f,0x7f,0x78,0x78,0x78,0x00,
+  0x00,0x30,0x3e,0x3e,0x30,0x30,0x30,0x00,0x00,0x00,0x3e,0x3e,0x22,0x00,0x00,0x00,
+  0x00,0x06,0x3e,0x3e,0x06,0x06,0x06,0x00,0x0f,0x17,0x7f,0x7f,0x0f,0x0f,0x0f,0x00,
+  0x3f,0x37,0xff,0xff,0x1f,0x1f,0x1f,0x00,0x7f,0x77,0xff,0xff,0x3f,0x3f,0x3f,0x7f,
+  0xfe,0xf7,0xff,0xff,0xff,0xfc,0xfc,0xfc,0x78,0x77,0x7f,0x7f,0x7f,0x78,0x78,0x78,
+  0x00,0x77,0x7f,0x7f,0x7f,0x71,0x30,0x30,0x00,0x77,0x7f,0x7f,0x7f,0x63,0x00,0x00,
+  0x00,0x77,0x7f,0x7f,0x7f,0x47,0x06,0x06,0x0f,0x77,0x7f,0x7f,0x7f,0x0f,0x0f,0x0f,
+  0x3f,0xf7,0xff,0xff,0xff,0x1f,0x1f,0x1f,0x7f,0xf7,0xff,0xff,0xff,0x3f,0x3f,0x3f,
+  0xff,0xf7,0xff,0xff,0xff,0xff,0xfc,0xfc,0xff,0xf7,0xff,0xff,0xff,0xff,0xf8,0x78,
+  0xff,0xf7,0xff,0xff,0xff,0xff,0xf1,0x30,0xff,0xf7,0xff,0xff,0xff,0xff,0xe3,0x00,
+  0xff,0xf7,0xff,0xff,0xff,0xff,0xc7,0x06,0xff,0xf7,0xff,0xff,0xff,0xff,0x8f,0x0f,
+  0xff,0xf7,0xff,0xff,0xff,0xff,0x1f,0x1f,0xff,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f,
+  0xfc,0xf4,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x10,0x10,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
+  0x04,0x04,0x1c,0x00,0x00,0x00,0x00,0x00,0x8f,0x87,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x1f,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0x37,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x78,0x74,0x7c,0x7f,0x7f,0x7f,0x00,0x00,0x78,0x70,0x78,0x7f,0x7f,0x7f,0x00,0x00,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x0f,0x07,0x0f,0x7f,0x7f,0x7f,0x00,0x00,
+  0x0f,0x17,0x1f,0x7f,0x7f,0x7f,0x00,0x00,0x3f,0x37,0x3f,0xff,0xff,0xff,0x3f,0x00,
+  0x78,0x74,0x7c,0x7c,0x7f,0x7c,0x00,0x00,0x00,0x30,0x38,0x38,0x3e,0x00,0x00,0x00,
+  0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x0e,0x0e,0x3e,0x00,0x00,0x00,
+  0x0f,0x17,0x1f,0x1f,0x7f,0x1f,0x00,0x00,0x3f,0x37,0x3f,0x3f,0xff,0x3f,0x3f,0x00,
+  0x78,0x74,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x30,0x38,0x38,0x38,0x00,0x00,0x00,
+  0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x06,0x0e,0x0e,0x0e,0x00,0x00,0x00,
+  0x0f,0x17,0x1f,0x1f,0x1f,0x1f,0x00,0x00,0x3f,0x37,0x3f,0x3f,0x3f,0x3f,0x3f,0x00,
+  0x78,0x74,0x7d,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x30,0x3a,0x38,0x38,0x00,0x00,0x00,
+  0x00,0x00,0x14,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x14,0x04,0x04,0x00,0x00,0x00,0x00,0x06,0x2e,0x0e,0x0e,0x00,0x00,0x00,
+  0x0f,0x17,0x5f,0x1f,0x1f,0x1f,0x00,0x00,0x3f,0x37,0xbf,0x3f,0x3f,0x3f,0x3f,0x00,
+  0x78,0x74,0x7c,0x7f,0x7c,0x7c,0x00,0x00,0x00,0x30,0x38,0x3e,0x38,0x38,0x00,0x00,
+  0x00,0x00,0x10,0x1c,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x04,0x1c,0x04,0x04,0x00,0x00,0x00,0x06,0x0e,0x3e,0x0e,0x0e,0x00,0x00,
+  0x0f,0x17,0x1f,0x7f,0x1f,0x1f,0x00,0x00,0x3f,0x37,0x3f,0xff,0x3f,0x3f,0x3f,0x00,
+  0x78,0x74,0x7f,0x7f,0x7f,0x7c,0x7c,0x00,0x00,0x30,0x3e,0x3e,0x3e,0x38,0x38,0x00,
+  0x00,0x00,0x3e,0x3e,0x3e,0x10,0x10,0x00,0x00,0x00,0x3e,0x3e,0x3e,0x00,0x00,0x00,
+  0x00,0x00,0x3e,0x3e,0x3e,0x04,0x04,0x00,0x00,0x06,0x3e,0x3e,0x3e,0x0e,0x0e,0x00,
+  0x0f,0x17,0x7f,0x7f,0x7f,0x1f,0x1f,0x00,0x3f,0x37,0xff,0xff,0xff,0x3f,0x3f,0x00,
+  0x78,0x77,0x7f,0x7f,0x7f,0x7f,0x7c,0x7c,0x00,0x77,0x7f,0x7f,0x7f,0x7f,0x38,0x38,
+  0x00,0x77,0x7f,0x7f,0x7f,0x7f,0x10,0x10,0x00,0x77,0x7f,0x7f,0x7f,0x7f,0x00,0x00,
+  0x00,0x77,0x7f,0x7f,0x7f,0x7f,0x04,0x04,0x00,0x77,0x7f,0x7f,0x7f,0x7f,0x0e,0x0e,
+  0x0f,0x77,0x7f,0x7f,0x7f,0x7f,0x1f,0x1f,0x3f,0xf7,0xff,0xff,0xff,0xff,0x3f,0x3f
+};
+
+#endif
@@ -21,6 +21,9 @@
 #include "eval.h"
 #include "rays.h"
 #include "bench.h"
+#include "datagen.h"
+#include "analyze.h"
+#include "train.h"
 #include "nnue.h"
 #include <cstring>
 
@@ -41,7 +44,25 @@ int main(int argCount, char* argValue[]) {
   myOrdering = new OrderingInfo();
 
   if (argCount > 1 && strcmp("bench", argValue[1]) == 0){
-    myBench();
+    myBench(argCount, argValue);
+    return 0;
+  }else if(argCount > 1 && strcmp("datagen", argValue[1]) == 0){
+    datagen(argCount, argValue);
+    return 0;
+  }else if(argCount > 1 && strcmp("pack", argValue[1]) == 0){
+    packPositions(argCount, argValue);
+    return 0;
+  }else if(argCount > 1 && strcmp("unpack", argValue[1]) == 0){
+    unpackPositions(argCount, argValue);
+    return 0;
+  }else if(argCount > 1 && strcmp("analyze", argValue[1]) == 0){
+    analyze(argCount, argValue);
+    return 0;
+  }else if(argCount > 1 && strcmp("testsuite", argValue[1]) == 0){
+    testSuite(argCount, argValue);
+    return 0;
+  }else if(argCount > 1 && strcmp("train", argValue[1]) == 0){
+    train(argCount, argValue);
     return 0;
   }else if(argCount > 1 && strcmp("see", argValue[1]) == 0){
     testSEE();
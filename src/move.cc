@@ -17,6 +17,8 @@
 */
 #include "move.h"
 #include "eval.h"
+#include "movegen.h"
+#include <cstring>
 #include <iostream>
 #include <algorithm>
 
@@ -163,3 +165,136 @@ unsigned int Move::notationToIndex(std::string notation) {
 
   return rank * 8 + file;
 }
+
+Move Move::fromNotation(const Board &board, const std::string &notation, bool isFrc) {
+  if (notation.size() < 4 ||
+      notation[0] < 'a' || notation[0] > 'h' || notation[1] < '1' || notation[1] > '8' ||
+      notation[2] < 'a' || notation[2] > 'h' || notation[3] < '1' || notation[3] > '8') {
+    return Move();
+  }
+
+  Color color = board.getActivePlayer();
+  Color other = board.getInactivePlayer();
+  int from = (notation[1] - '1') * 8 + (notation[0] - 'a');
+  int to   = (notation[3] - '1') * 8 + (notation[2] - 'a');
+
+  if (!(board.getAllPieces(color) & (ONE << from))) {
+    return Move();
+  }
+
+  PieceType moving = board.getPieceAtSquare(color, from);
+  Move move;
+
+  if (moving == KING && board.getCastlingRightsColored(color)) {
+    // Castling is encoded as king -> rook square
+    // FRC: king "captures" own rook, classical: king jumps two files
+    int rookSquare = -1;
+    if (isFrc && (board.getPieces(color, ROOK) & (ONE << to))) {
+      rookSquare = to;
+    } else if (!isFrc && _row(from) == _row(to) && abs(from - to) == 2) {
+      U64 castlingRights = board.getCastlingRightsColored(color);
+      while (castlingRights) {
+        int sq = _popLsb(castlingRights);
+        if ((sq > from) == (to > from)) rookSquare = sq;
+      }
+    }
+
+    if (rookSquare != -1) {
+      move = Move(from, rookSquare, KING, rookSquare > from ? KSIDE_CASTLE : QSIDE_CASTLE);
+      return board.moveIsPseudoLegal(move) ? move : Move();
+    }
+  }
+
+  move = Move(from, to, moving);
+
+  if (board.getAllPieces(other) & (ONE << to)) {
+    move.setFlag(CAPTURE);
+    move.setCapturedPieceType(board.getPieceAtSquare(other, to));
+  } else if (moving == PAWN && (board.getEnPassant() & (ONE << to))) {
+    move.setFlag(EN_PASSANT);
+  } else if (moving == PAWN && abs(from - to) == 16) {
+    move.setFlag(DOUBLE_PAWN_PUSH);
+  }
+
+  if (notation.size() > 4) {
+    PieceType promotion;
+    switch (notation[4]) {
+      case 'q': promotion = QUEEN;
+        break;
+      case 'r': promotion = ROOK;
+        break;
+      case 'n': promotion = KNIGHT;
+        break;
+      case 'b': promotion = BISHOP;
+        break;
+      default: return Move();
+    }
+    move.setFlag(PROMOTION);
+    move.setPromotionPieceType(promotion);
+  }
+
+  return board.moveIsPseudoLegal(move) ? move : Move();
+}
+
+Move Move::fromSan(const Board &board, const std::string &san) {
+  std::string s = san;
+  while (!s.empty() && strchr("+#!?", s.back())) s.pop_back();
+
+  unsigned int castle = 0;
+  if (s == "O-O" || s == "0-0") castle = KSIDE_CASTLE;
+  if (s == "O-O-O" || s == "0-0-0") castle = QSIDE_CASTLE;
+
+  const std::string PIECES = "PRNBQK";
+  PieceType piece = PAWN;
+  if (!castle && !s.empty() && PIECES.find(s[0]) != std::string::npos) {
+    piece = PieceType(PIECES.find(s[0]));
+    s.erase(0, 1);
+  }
+
+  // promotion: "e8=Q" or "e8Q"
+  int promotion = -1;
+  if (!castle && piece == PAWN && s.size() > 2 && PIECES.find(s.back()) != std::string::npos) {
+    promotion = PIECES.find(s.back());
+    s.pop_back();
+    if (s.back() == '=') s.pop_back();
+  }
+
+  s.erase(std::remove(s.begin(), s.end(), 'x'), s.end());
+  if (!castle && (s.size() < 2 || s.size() > 4)) return fromNotation(board, san, board.getFrcMode());
+
+  int to = castle ? -1 : notationToIndex(s.substr(s.size() - 2));
+  std::string disambiguation = castle ? "" : s.substr(0, s.size() - 2);
+
+  MoveList moves;
+  MoveGen(&board, false, &moves);
+
+  Move found;
+  int matches = 0;
+  for (auto &move : moves) {
+    if (castle) {
+      if (!(move.getFlags() & castle)) continue;
+    } else {
+      if ((int) move.getTo() != to || move.getPieceType() != piece) continue;
+      if ((move.getFlags() & (KSIDE_CASTLE | QSIDE_CASTLE))) continue;
+      if (promotion != -1 && (!(move.getFlags() & PROMOTION) || (int) move.getPromotionPieceType() != promotion)) continue;
+      if (promotion == -1 && (move.getFlags() & PROMOTION)) continue;
+
+      std::string from = indexToNotation(move.getFrom());
+      bool ambiguous = false;
+      for (char c : disambiguation) {
+        if (c != from[0] && c != from[1]) ambiguous = true;
+      }
+      if (ambiguous) continue;
+    }
+
+    Board movedBoard = board;
+    if (movedBoard.doMove(move)) {
+      found = move;
+      matches++;
+    }
+  }
+
+  if (matches == 1) return found;
+
+  return matches == 0 ? fromNotation(board, san, board.getFrcMode()) : Move();
+}
@@ -202,6 +202,36 @@ class Move {
    */
   static std::string indexToNotation(int);
 
+  /**
+   * @brief Returns the Move described by the given UCI move string on the given board.
+   *
+   * Move is built directly from the from/to squares and the pieces on the board,
+   * so no move generation is needed. Castling is accepted both in the standard
+   * (e1g1) and in the FRC (king takes own rook) form.
+   *
+   * If the string does not describe a pseudo-legal move on the board, a null move
+   * is returned.
+   *
+   * @param  board     Board the move is made on
+   * @param  notation  UCI move string (eg. "e2e4", "a7a8q")
+   * @param  isFrc     is this FRC position
+   * @return The Move for the given notation, or a null move
+   */
+  static Move fromNotation(const Board &, const std::string &, bool);
+
+  /**
+   * @brief Returns the legal Move described by the given SAN string on the given board.
+   *
+   * Check and annotation symbols are ignored, castling may be written
+   * with letter O or digit 0. UCI move strings are accepted too.
+   *
+   * @param  board  Board the move is made on
+   * @param  san    SAN move string (eg. "Nf3", "exd5", "e8=Q+", "O-O")
+   * @return The Move for the given string, or a null move if there is
+   *         no such legal move or it is ambiguous
+   */
+  static Move fromSan(const Board &, const std::string &);
+
  private:
   /**
    * @brief A packed integer containing all of the move data.
@@ -29,6 +29,12 @@
 
 const int NNUE_SCALE = 16 * 512;
 
+// Quantization used by the trainer: hidden layer is scaled by NNUE_QA,
+// output weights by NNUE_QB. Engine only divides by their product.
+const int NNUE_QA = 512;
+const int NNUE_QB = 16;
+static_assert(NNUE_QA * NNUE_QB == NNUE_SCALE, "NNUE quantization does not match NNUE_SCALE");
+
 const std::string EVAL_FILE = "equi_7b_1024x2F_7Bv8_430.nnue";
 
 class Board;
@@ -75,6 +81,11 @@ public:
 
     int16_t * getHalfAccumulatorPtr(Color);
 
+    // input index of the piece for the given perspective, used by the trainer
+    int getFeatureIndex(int sq, PieceType pt, Color c, Color view, int ksq){
+        return _getPieceIndex(sq, pt, c, view, ksq);
+    }
+
 
 private:
 
@@ -36,6 +36,18 @@ void OrderingInfo::clearKillers(){
   std::memset(_killer2, 0, sizeof(_killer2));
 }
 
+void OrderingInfo::shiftKillers(int plies){
+  if (plies == 0) return;
+  if (plies < 0 || plies >= MAX_INT_PLY){
+    clearKillers();
+    return;
+  }
+  std::memmove(_killer1, _killer1 + plies, sizeof(int) * (MAX_INT_PLY - plies));
+  std::memmove(_killer2, _killer2 + plies, sizeof(int) * (MAX_INT_PLY - plies));
+  std::memset(_killer1 + MAX_INT_PLY - plies, 0, sizeof(int) * plies);
+  std::memset(_killer2 + MAX_INT_PLY - plies, 0, sizeof(int) * plies);
+}
+
 void OrderingInfo::clearChildrenKillers(int ply){
   _killer1[ply + 2] = 0;
   _killer2[ply + 2] = 0;
@@ -49,6 +49,14 @@ class OrderingInfo {
    */
   void clearKillers();
 
+  /**
+   * @brief shift killers towards the root by the given number of plies.
+   *
+   * Used when the new search starts from a position reached from the previous
+   * root, so killers of deeper plies are still meaningful.
+   */
+  void shiftKillers(int);
+
   /**
    * @brief clear killers and counters
    */
@@ -0,0 +1,454 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "packedpos.h"
+#include "movegen.h"
+#include "bitutils.h"
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// bytes written or read by one system call
+const size_t PACKED_BUFFER_SIZE = 1 << 21;
+
+// size of the chain header: first position and number of following positions
+const size_t CHAIN_HEADER_SIZE = sizeof(PackedPos) + 2;
+const size_t CHAIN_ENTRY_SIZE  = 4;
+
+PackedPos Packed::pack(const Board &board, int score, Move move){
+    PackedPos pos;
+    std::memset(&pos, 0, sizeof(pos));
+
+    pos.occupied = board.getOccupied();
+
+    // pawn that can be captured en passant stands in front of the target square
+    int epPawn = -1;
+    if (board.getEnPassant()){
+        int target = _bitscanForward(board.getEnPassant());
+        epPawn = board.getActivePlayer() == WHITE ? target - 8 : target + 8;
+    }
+
+    U64 occupied = pos.occupied;
+    for (int i = 0; occupied; i++){
+        int square = _popLsb(occupied);
+        Color color = board.getAllPieces(WHITE) & (ONE << square) ? WHITE : BLACK;
+        int code = board.getPieceAtSquare(color, square) + 6 * color;
+
+        if (square == epPawn){
+            code = PACKED_EP_PAWN;
+        }else if (board.getCastlingRights() & (ONE << square)){
+            code = color == WHITE ? PACKED_WHITE_CROOK : PACKED_BLACK_CROOK;
+        }
+
+        pos.pieces[i / 2] |= code << (4 * (i % 2));
+    }
+
+    pos.score    = std::max(-32767, std::min(score, 32767));
+    pos.flags    = board.getActivePlayer() | (RESULT_DRAW << 1);
+    pos.halfmove = std::min(board.getHalfmoveClock(), 255);
+    pos.fullmove = std::max(1, board._getGameClock() / 2);
+
+    if (!(move.getFlags() & Move::NULL_MOVE)){
+        int promotion = move.getFlags() & Move::PROMOTION ? move.getPromotionPieceType() : 0;
+        pos.move = move.getFrom() | (move.getTo() << 6) | (promotion << 12);
+    }
+
+    return pos;
+}
+
+void Packed::setResult(PackedPos &pos, GameResult result){
+    pos.flags = (pos.flags & ~6) | (result << 1);
+}
+
+GameResult Packed::getResult(const PackedPos &pos){
+    return GameResult((pos.flags >> 1) & 3);
+}
+
+Color Packed::getActivePlayer(const PackedPos &pos){
+    return Color(pos.flags & 1);
+}
+
+std::string Packed::toFen(const PackedPos &pos){
+    const char PIECE_CHARS[] = "PRNBQKprnbqk";
+
+    char squares[64];
+    std::memset(squares, 0, sizeof(squares));
+    std::string castling, enPassant = "-";
+
+    U64 occupied = pos.occupied;
+    for (int i = 0; occupied; i++){
+        int square = _popLsb(occupied);
+        int code = (pos.pieces[i / 2] >> (4 * (i % 2))) & 15;
+
+        if (code == PACKED_EP_PAWN){
+            // white pawn after double push is on the 4th rank
+            bool white = _row(square) == 3;
+            squares[square] = white ? 'P' : 'p';
+            enPassant = Move::indexToNotation(white ? square - 8 : square + 8);
+        }else if (code == PACKED_WHITE_CROOK || code == PACKED_BLACK_CROOK){
+            bool white = code == PACKED_WHITE_CROOK;
+            squares[square] = white ? 'R' : 'r';
+            char right = square == h1 ? 'K' : square == a1 ? 'Q' : 'A' + _col(square);
+            if (!white) right = square == h8 ? 'k' : square == a8 ? 'q' : 'a' + _col(square);
+            castling += right;
+        }else{
+            squares[square] = PIECE_CHARS[code];
+        }
+    }
+
+    // KQkq order
+    std::sort(castling.begin(), castling.end(), [](char a, char b){
+        bool upperA = isupper(a), upperB = isupper(b);
+        return upperA != upperB ? upperA : a < b;
+    });
+
+    std::string fen;
+    for (int rank = 7; rank >= 0; rank--){
+        int empty = 0;
+        for (int file = 0; file < 8; file++){
+            char piece = squares[rank * 8 + file];
+            if (!piece) {empty++; continue;}
+            if (empty) fen += std::to_string(empty);
+            empty = 0;
+            fen += piece;
+        }
+        if (empty) fen += std::to_string(empty);
+        if (rank) fen += '/';
+    }
+
+    fen += getActivePlayer(pos) == WHITE ? " w " : " b ";
+    fen += (castling.empty() ? "-" : castling) + " " + enPassant;
+    fen += " " + std::to_string(pos.halfmove) + " " + std::to_string(pos.fullmove);
+    return fen;
+}
+
+Move Packed::getMove(const Board &board, const PackedPos &pos){
+    unsigned int from = pos.move & 63;
+    unsigned int to = (pos.move >> 6) & 63;
+    int promotion = (pos.move >> 12) & 7;
+
+    if (from == to) return Move();
+
+    MoveList moves;
+    MoveGen(&board, false, &moves);
+    for (auto &move : moves){
+        if (move.getFrom() != from || move.getTo() != to) continue;
+        if ((move.getFlags() & Move::PROMOTION) && move.getPromotionPieceType() != promotion) continue;
+
+        Board movedBoard = board;
+        if (movedBoard.doMove(move)) return move;
+    }
+
+    return Move();
+}
+
+bool Packed::fromText(const std::string &line, PackedPos &pos){
+    size_t first = line.find('|');
+    size_t second = first == std::string::npos ? first : line.find('|', first + 1);
+    if (second == std::string::npos) return false;
+
+    std::istringstream scoreStream(line.substr(first + 1, second - first - 1));
+    std::istringstream resultStream(line.substr(second + 1));
+    int score;
+    std::string result;
+    if (!(scoreStream >> score) || !(resultStream >> result)) return false;
+
+    GameResult gameResult;
+    if (result == "1.0" || result == "1" || result == "1-0") gameResult = RESULT_WHITE_WIN;
+    else if (result == "0.5" || result == "1/2-1/2") gameResult = RESULT_DRAW;
+    else if (result == "0.0" || result == "0" || result == "0-1") gameResult = RESULT_BLACK_WIN;
+    else return false;
+
+    Board board(line.substr(0, first), false);
+    pos = pack(board, board.getActivePlayer() == WHITE ? score : -score, Move());
+    setResult(pos, gameResult);
+    return true;
+}
+
+std::string Packed::toText(const PackedPos &pos){
+    const char * RESULTS[3] = {"0.0", "0.5", "1.0"};
+    int score = getActivePlayer(pos) == WHITE ? pos.score : -pos.score;
+    return toFen(pos) + " | " + std::to_string(score) + " | " + RESULTS[getResult(pos)];
+}
+
+void Packed::encodeChain(const std::vector<PackedPos> &positions, std::vector<uint8_t> &out){
+    if (positions.empty()) return;
+
+    uint16_t following = positions.size() - 1;
+    const uint8_t * first = reinterpret_cast<const uint8_t *>(&positions[0]);
+    out.insert(out.end(), first, first + sizeof(PackedPos));
+    out.push_back(following & 0xFF);
+    out.push_back(following >> 8);
+
+    for (size_t i = 1; i <= following; i++){
+        // delta is stored modulo 2^16, so mate scores survive it
+        uint16_t move  = positions[i].move | (positions[i].flags & PACKED_SKIP ? 0x8000 : 0);
+        uint16_t delta = uint16_t(positions[i].score + positions[i - 1].score);
+        out.push_back(move & 0xFF);
+        out.push_back(move >> 8);
+        out.push_back(delta & 0xFF);
+        out.push_back(delta >> 8);
+    }
+}
+
+size_t Packed::decodeChain(const uint8_t * data, size_t size, std::vector<PackedPos> &positions){
+    positions.clear();
+    if (size < CHAIN_HEADER_SIZE) return 0;
+
+    size_t following = data[sizeof(PackedPos)] | (data[sizeof(PackedPos) + 1] << 8);
+    size_t chainSize = CHAIN_HEADER_SIZE + following * CHAIN_ENTRY_SIZE;
+    if (size < chainSize) return 0;
+
+    PackedPos pos;
+    std::memcpy(&pos, data, sizeof(PackedPos));
+    positions.push_back(pos);
+    if (!following) return chainSize;
+
+    Board board(toFen(pos), false);
+    const uint8_t * entry = data + CHAIN_HEADER_SIZE;
+
+    for (size_t i = 0; i < following; i++, entry += CHAIN_ENTRY_SIZE){
+        Move move = getMove(board, positions.back());
+        if (move.getFlags() & Move::NULL_MOVE){
+            fatal("Corrupted chain: illegal move in " + toFen(positions.back()));
+        }
+        board.doMove(move);
+
+        uint16_t nextMove = entry[0] | (entry[1] << 8);
+        uint16_t delta    = entry[2] | (entry[3] << 8);
+
+        PackedPos next = pack(board, int16_t(delta - positions.back().score), Move());
+        next.move  = nextMove & 0x7FFF;
+        next.flags |= nextMove & 0x8000 ? PACKED_SKIP : 0;
+        setResult(next, getResult(pos));
+        positions.push_back(next);
+    }
+
+    return chainSize;
+}
+
+namespace {
+
+size_t countQuiet(const PackedPos * positions, size_t number){
+    size_t quiet = 0;
+    for (size_t i = 0; i < number; i++){
+        if (!(positions[i].flags & PACKED_SKIP)) quiet++;
+    }
+    return quiet;
+}
+
+}
+
+PackedWriter::PackedWriter() : _file(nullptr), _count(0), _quietCount(0) {
+    _buffer.reserve(PACKED_BUFFER_SIZE);
+}
+
+PackedWriter::~PackedWriter(){
+    close();
+}
+
+void PackedWriter::open(const std::string &path, bool append, bool chains){
+    close();
+    _count = 0;
+    _quietCount = 0;
+
+    struct stat st;
+    if (append && stat(path.c_str(), &st) == 0){
+        // count existing positions, drop a partially written record or chain
+        U64 complete = st.st_size - st.st_size % sizeof(PackedPos);
+        _count = complete / sizeof(PackedPos);
+        // records are written without skipped positions (datagen and pack drop them)
+        _quietCount = _count;
+
+        if (chains){
+            PackedReader reader;
+            std::vector<PackedPos> positions;
+            reader.open(path);
+            _count = 0;
+            _quietCount = 0;
+            complete = 0;
+            while (reader.readChain(positions)){
+                _count += positions.size();
+                _quietCount += countQuiet(positions.data(), positions.size());
+                complete = reader.offset();
+            }
+        }
+
+        if ((off_t) complete != st.st_size && truncate(path.c_str(), complete) != 0){
+            fatal("Failed to truncate " + path);
+        }
+    }
+
+    _file = fopen(path.c_str(), append ? "ab" : "wb");
+    if (_file == nullptr){
+        fatal("Failed to open " + path);
+    }
+}
+
+void PackedWriter::write(const PackedPos * positions, size_t number){
+    const uint8_t * data = reinterpret_cast<const uint8_t *>(positions);
+    _buffer.insert(_buffer.end(), data, data + number * sizeof(PackedPos));
+    _count += number;
+    _quietCount += countQuiet(positions, number);
+    if (_buffer.size() >= PACKED_BUFFER_SIZE) flush();
+}
+
+void PackedWriter::writeChain(const std::vector<PackedPos> &positions){
+    Packed::encodeChain(positions, _buffer);
+    _count += positions.size();
+    _quietCount += countQuiet(positions.data(), positions.size());
+    if (_buffer.size() >= PACKED_BUFFER_SIZE) flush();
+}
+
+void PackedWriter::flush(){
+    if (_file == nullptr || _buffer.empty()) return;
+
+    if (fwrite(_buffer.data(), 1, _buffer.size(), _file) != _buffer.size()){
+        fatal("Failed to write packed positions");
+    }
+    fflush(_file);
+    _buffer.clear();
+}
+
+void PackedWriter::close(){
+    if (_file == nullptr) return;
+
+    flush();
+    fclose(_file);
+    _file = nullptr;
+}
+
+U64 PackedWriter::count() const {
+    return _count;
+}
+
+U64 PackedWriter::quietCount() const {
+    return _quietCount;
+}
+
+PackedReader::PackedReader() : _file(nullptr), _begin(0), _end(0), _offset(0) {}
+
+PackedReader::~PackedReader(){
+    close();
+}
+
+void PackedReader::open(const std::string &path){
+    close();
+
+    _file = fopen(path.c_str(), "rb");
+    if (_file == nullptr){
+        fatal("Failed to open " + path);
+    }
+    _buffer.resize(PACKED_BUFFER_SIZE);
+    _begin = _end = 0;
+    _offset = 0;
+}
+
+void PackedReader::close(){
+    if (_file != nullptr) fclose(_file);
+    _file = nullptr;
+}
+
+bool PackedReader::_fill(size_t bytes){
+    if (_end - _begin >= bytes) return true;
+    if (_file == nullptr) return false;
+
+    // move the rest to the start, grow buffer for long chains
+    std::memmove(_buffer.data(), _buffer.data() + _begin, _end - _begin);
+    _end -= _begin;
+    _begin = 0;
+    if (_buffer.size() < bytes) _buffer.resize(bytes);
+
+    _end += fread(_buffer.data() + _end, 1, _buffer.size() - _end, _file);
+    return _end >= bytes;
+}
+
+bool PackedReader::read(PackedPos &pos){
+    if (!_fill(sizeof(PackedPos))) return false;
+
+    std::memcpy(&pos, _buffer.data() + _begin, sizeof(PackedPos));
+    _begin  += sizeof(PackedPos);
+    _offset += sizeof(PackedPos);
+    return true;
+}
+
+bool PackedReader::readChain(std::vector<PackedPos> &positions){
+    if (!_fill(CHAIN_HEADER_SIZE)) return false;
+
+    const uint8_t * header = _buffer.data() + _begin + sizeof(PackedPos);
+    size_t chainSize = CHAIN_HEADER_SIZE + (header[0] | (header[1] << 8)) * CHAIN_ENTRY_SIZE;
+    if (!_fill(chainSize)) return false;
+
+    Packed::decodeChain(_buffer.data() + _begin, chainSize, positions);
+    _begin  += chainSize;
+    _offset += chainSize;
+    return true;
+}
+
+U64 PackedReader::offset() const {
+    return _offset;
+}
+
+PackedFile::PackedFile() : _data(nullptr), _bytes(0) {}
+
+PackedFile::~PackedFile(){
+    close();
+}
+
+void PackedFile::open(const std::string &path){
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1){
+        fatal("Failed to open " + path);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1){
+        ::close(fd);
+        fatal("Failed to stat " + path);
+    }
+    _bytes = st.st_size - st.st_size % sizeof(PackedPos);
+
+    if (_bytes){
+        void * data = mmap(nullptr, _bytes, PROT_READ, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED){
+            ::close(fd);
+            fatal("Failed to map " + path);
+        }
+        _data = static_cast<const PackedPos *>(data);
+    }
+    ::close(fd);
+}
+
+void PackedFile::close(){
+    if (_data != nullptr) munmap(const_cast<PackedPos *>(_data), _bytes);
+    _data = nullptr;
+    _bytes = 0;
+}
+
+U64 PackedFile::size() const {
+    return _bytes / sizeof(PackedPos);
+}
+
+const PackedPos &PackedFile::operator[](U64 index) const {
+    return _data[index];
+}
@@ -0,0 +1,317 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef PACKEDPOS_H
+#define PACKEDPOS_H
+
+#include "defs.h"
+#include "board.h"
+#include "move.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Piece codes of the packed position (4 bits per piece)
+ *
+ * Pieces are PieceType + 6 * Color, special codes keep en passant
+ * and castling rights (also for Chess960) without extra fields.
+ */
+enum PackedPiece {
+  PACKED_EP_PAWN     = 12, /**< Pawn that has just made a double push, color is given by its rank */
+  PACKED_WHITE_CROOK = 13, /**< White rook with castling right */
+  PACKED_BLACK_CROOK = 14  /**< Black rook with castling right */
+};
+
+/**
+ * @brief Result of the game, from white point of view
+ */
+enum GameResult {
+  RESULT_BLACK_WIN = 0,
+  RESULT_DRAW      = 1,
+  RESULT_WHITE_WIN = 2
+};
+
+/**
+ * @brief Position is not a training sample (side to move is in check,
+ * or the best move is a capture or promotion), set in PackedPos::flags
+ */
+#define PACKED_SKIP         (8)
+
+/**
+ * @brief Training position packed into 32 bytes.
+ *
+ * Pieces are listed in order of the occupancy bits, two per byte,
+ * first piece in the low nibble.
+ */
+struct PackedPos {
+  U64      occupied;    /**< All pieces of the position */
+  uint8_t  pieces[16];  /**< 4-bit piece codes, see PackedPiece */
+  int16_t  score;       /**< Search score, side to move point of view */
+  uint16_t move;        /**< Best move: from | to << 6 | promotion piece << 12 */
+  uint8_t  flags;       /**< Bit 0 - side to move, bits 1-2 - GameResult, PACKED_SKIP */
+  uint8_t  halfmove;    /**< Halfmove clock */
+  uint16_t fullmove;    /**< Fullmove number */
+};
+
+static_assert(sizeof(PackedPos) == 32, "PackedPos should take 32 bytes");
+
+/**
+ * @brief Tools to convert positions to and from the packed format.
+ *
+ * Text format of positions is "<FEN> | <score> | <result>", where score
+ * is from white point of view and result is 1.0, 0.5 or 0.0 (white win,
+ * draw, black win; "1-0", "1/2-1/2" and "0-1" are also accepted).
+ *
+ * Chain is a compact encoding of consecutive positions of a game, where
+ * every next position is reached by the best move of the previous one:
+ * first position in full, number of following positions (16 bits), and
+ * "move + score delta" entry (4 bytes) for every following position.
+ * Move has PACKED_SKIP flag in its top bit, score delta is the sum of
+ * the position score and the previous position score.
+ */
+namespace Packed {
+
+/**
+ * @brief Packs the given position.
+ *
+ * @param board Position to pack
+ * @param score Score of the side to move
+ * @param move Best move of the position
+ * @return Packed position, game result is set to a draw
+ */
+PackedPos pack(const Board &, int, Move);
+
+/**
+ * @brief Sets game result of the packed position
+ *
+ * @param pos Packed position
+ * @param result GameResult of the game the position is from
+ */
+void setResult(PackedPos &, GameResult);
+
+/**
+ * @brief Returns game result of the packed position
+ */
+GameResult getResult(const PackedPos &);
+
+/**
+ * @brief Returns side to move of the packed position
+ */
+Color getActivePlayer(const PackedPos &);
+
+/**
+ * @brief Returns FEN of the packed position
+ */
+std::string toFen(const PackedPos &);
+
+/**
+ * @brief Finds the best move of the packed position on the board.
+ *
+ * @param board Board set to the packed position
+ * @param pos Packed position
+ * @return Best move, null move if there is no such legal move
+ */
+Move getMove(const Board &, const PackedPos &);
+
+/**
+ * @brief Converts a text line ("<FEN> | <score> | <result>") to packed position
+ *
+ * @param line Text line
+ * @param pos Packed position
+ * @return false if the line has no score or result
+ */
+bool fromText(const std::string &, PackedPos &);
+
+/**
+ * @brief Converts packed position to a text line ("<FEN> | <score> | <result>")
+ */
+std::string toText(const PackedPos &);
+
+/**
+ * @brief Encodes consecutive positions of a game as a chain
+ *
+ * @param positions Positions of a game, at most 65536
+ * @param out Chain bytes are appended to it
+ */
+void encodeChain(const std::vector<PackedPos> &, std::vector<uint8_t> &);
+
+/**
+ * @brief Decodes a chain.
+ *
+ * @param data Chain bytes
+ * @param size Number of available bytes
+ * @param positions Decoded positions
+ * @return Size of the chain in bytes, 0 if the chain is incomplete
+ */
+size_t decodeChain(const uint8_t *, size_t, std::vector<PackedPos> &);
+}
+
+/**
+ * @brief Buffered writer of packed positions and chains.
+ *
+ * Data is collected in memory and written in large blocks.
+ * Writer can append to an existing file, so interrupted data
+ * generation can be resumed.
+ */
+class PackedWriter {
+ public:
+  PackedWriter();
+  ~PackedWriter();
+
+  /**
+   * @brief Opens the output file, fatal() if it is not possible.
+   *
+   * When appending, an incomplete record or chain at the end of the file
+   * (left by an interrupted writer) is removed.
+   *
+   * @param path File to write
+   * @param append If true, new positions are added after the existing ones
+   * @param chains If true, file consists of chains
+   */
+  void open(const std::string &, bool, bool= false);
+
+  /**
+   * @brief Writes the given positions.
+   *
+   * @param positions Positions to write
+   * @param number Number of positions
+   */
+  void write(const PackedPos *, size_t);
+
+  /**
+   * @brief Writes consecutive positions of a game as a chain
+   *
+   * @param positions Positions of a game
+   */
+  void writeChain(const std::vector<PackedPos> &);
+
+  /**
+   * @brief Writes buffered data to the file
+   */
+  void flush();
+
+  /**
+   * @brief Closes the file, buffered data is written first
+   */
+  void close();
+
+  /**
+   * @brief Number of positions in the file, including the buffered
+   * and the ones existing before it was opened
+   */
+  U64 count() const;
+
+  /**
+   * @brief Number of positions without PACKED_SKIP (the ones used for
+   * training), counted like count()
+   */
+  U64 quietCount() const;
+
+ private:
+  FILE * _file;
+  std::vector<uint8_t> _buffer;
+  U64 _count;
+  U64 _quietCount;
+};
+
+/**
+ * @brief Buffered sequential reader of packed positions and chains
+ */
+class PackedReader {
+ public:
+  PackedReader();
+  ~PackedReader();
+
+  /**
+   * @brief Opens the file, fatal() if it is not possible
+   *
+   * @param path File to read
+   */
+  void open(const std::string &);
+
+  /**
+   * @brief Reads the next position
+   *
+   * @param pos Read position
+   * @return false at the end of the file
+   */
+  bool read(PackedPos &);
+
+  /**
+   * @brief Reads the next chain
+   *
+   * @param positions Positions of the chain
+   * @return false at the end of the file or if the last chain is incomplete
+   */
+  bool readChain(std::vector<PackedPos> &);
+
+  /**
+   * @brief Number of bytes of the file read so far
+   */
+  U64 offset() const;
+
+  void close();
+
+ private:
+  FILE * _file;
+  std::vector<uint8_t> _buffer;
+  size_t _begin;
+  size_t _end;
+  U64 _offset;
+
+  /**
+   * @brief Makes at least the given number of bytes available in the buffer
+   * @return false if the file has less bytes left
+   */
+  bool _fill(size_t);
+};
+
+/**
+ * @brief Memory mapped file of packed positions, for random access
+ */
+class PackedFile {
+ public:
+  PackedFile();
+  ~PackedFile();
+
+  /**
+   * @brief Maps the file, fatal() if it is not possible
+   *
+   * @param path File to map
+   */
+  void open(const std::string &);
+
+  void close();
+
+  /**
+   * @brief Number of positions in the file
+   */
+  U64 size() const;
+
+  /**
+   * @brief Returns position with the given index
+   */
+  const PackedPos &operator[](U64) const;
+
+ private:
+  const PackedPos * _data;
+  size_t _bytes;
+};
+
+#endif
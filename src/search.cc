@@ -20,7 +20,9 @@
 #include "eval.h"
 #include "movepicker.h"
 #include "searchdata.h"
+#include "syzygy.h"
 #include <cstring>
+#include <unordered_map>
 #include <thread>
 #include <algorithm>
 #include <iostream>
@@ -32,6 +34,16 @@ extern Search         * cSearch[MAX_THREADS];
 extern std::thread      cThread[MAX_THREADS];
 extern HASH           * myHASH;
 
+THREAD_Counter cCounters[MAX_THREADS];
+
+// Depth skipping schedules of helper threads:
+// helper skips depth if ((depth + phase) / size) is odd,
+// so threads are spread over different iterations instead of
+// searching the same tree
+const int SKIP_SCHEDULES = 20;
+const int SKIP_SIZE[SKIP_SCHEDULES]  = {1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4};
+const int SKIP_PHASE[SKIP_SCHEDULES] = {0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7};
+
 
 void Search::init_LMR_array(){
 
@@ -53,122 +65,305 @@ void Search::init_LMR_array(){
 
 }
 
-Search::Search(const Board &board, Limits limits, Hist positionHistory, OrderingInfo *info, bool logUci) :
+Search::Search(const Board &board, Limits limits, const Hist &positionHistory, OrderingInfo *info, bool logUci, int threadId) :
     _orderingInfo(*info),
+    _hash(myHASH),
     _timer(limits, board.getActivePlayer(), board._getGameClock() / 2),
     _initialBoard(board),
     _logUci(logUci),
-    _stop(false),
-    _nodes(0),
+    _ownStop(false),
+    _stop(&_ownStop),
+    _ponderHit(false),
+    _counter(&cCounters[threadId]),
+    _threadId(threadId),
     _bestScore(0)
      {
 
-  _sStack = SEARCH_Data();
-  _posHist = positionHistory;
-  _nnStack[0] = NNueEvaluation(_initialBoard);
-  _initialBoard.setNnuePtr(&_nnStack[0]);
   init_LMR_array();
+  _populateFinnyTable();
+  setPosition(board, limits, positionHistory);
+}
+
+void Search::setPosition(const Board &board, Limits limits, const Hist &positionHistory){
+  // Check if new root is reached from the previous one:
+  // previous root must be in the game history exactly "plies" moves ago
+  int plies = board._getGameClock() - _initialBoard._getGameClock();
+  int prevRootIndx = positionHistory.head - 1 - plies;
+  bool sameGame = plies >= 0 && prevRootIndx >= 0 &&
+                  positionHistory.hisKey[prevRootIndx] == _initialBoard.getZKey().getValue();
+
+  // Killers of the previous search are still useful, just plies closer to root
+  _orderingInfo.shiftKillers(sameGame ? plies : -1);
+
+  // Copy only part of the history that was added since the previous search
+  int copyFrom = (sameGame && _posHist.head == prevRootIndx + 1) ? _posHist.head : 0;
+  std::memcpy(_posHist.hisKey + copyFrom, positionHistory.hisKey + copyFrom, sizeof(U64) * (positionHistory.head - copyFrom));
+  _posHist.head = positionHistory.head;
+
+  _limits = limits;
+  _timer = Timer(limits, board.getActivePlayer(), board._getGameClock() / 2);
+  _initialBoard = board;
+  _initialBoard.setNnuePtr(&_nnStack[0]);
+  _initialBoard.refreshAccumulator(&_finnyTable, &_nnCache);
+
+  _sStack = SEARCH_Data();
+  _ourPV = pV();
+  _bestMove = Move();
+  _bestScore = 0;
+  _selDepth = 0;
+  _counter->Reset();
+  *_stop = false;
+  _ponderHit = false;
+  _nextLimitCheck = 0;
 }
 
 void Search::iterDeep() {
 
-  _nodes = 0;
+  Stats::attach(_threadId);
+  _counter->Reset();
   _selDepth = 0;
-  std::memset(_rootNodesSpent, 0, sizeof(_rootNodesSpent));
+  _completedDepth = 0;
   _timer.startIteration();
-  _populateFinnyTable();
   int maxDepthSearched = 0;
 
   int targetDepth = _timer.getSearchDepth();
   int aspWindow = 30;
-  int aspDelta  = 48;
+
+  _initRootMoves();
+  _rootProbeTB();
+  int multiPV = std::max(1, std::min(_limits.multiPV, (int) _rootMoves.size()));
+
+  // every principal variation uses its own aspiration window
+  std::vector<int> aspDelta(multiPV, 48);
 
     for (int currDepth = 1; currDepth <= targetDepth; currDepth++) {
-        maxDepthSearched = std::max(maxDepthSearched, currDepth);
 
+        if (_threadId > 0 && !_standalone && currDepth > 1){
+          int schedule = (_threadId - 1) % SKIP_SCHEDULES;
+          if (((currDepth + SKIP_PHASE[schedule]) / SKIP_SIZE[schedule]) % 2) continue;
+        }
+
+        maxDepthSearched = std::max(maxDepthSearched, currDepth);
 
-        int aspAlpha = LOST_SCORE;
-        int aspBeta  =-LOST_SCORE;
-        if (currDepth > 6){
-            aspAlpha = _bestScore - aspWindow;
-            aspBeta  = _bestScore + aspWindow;
+        for (auto &rm : _rootMoves){
+          rm.prevScore = rm.score;
+          rm.nodes = 0;
         }
 
-        while (true){
+        for (int pvIdx = 0; pvIdx < multiPV && !*_stop; pvIdx++){
 
-            int score = _rootMax(_initialBoard, aspAlpha, aspBeta, currDepth);
+          int prevScore = pvIdx == 0 ? _bestScore : _rootMoves[pvIdx].prevScore;
+          int aspAlpha = LOST_SCORE;
+          int aspBeta  =-LOST_SCORE;
+          if (currDepth > 6 && prevScore != -INF){
+              aspAlpha = prevScore - aspWindow;
+              aspBeta  = prevScore + aspWindow;
+          }
 
-            if (_stop) break;
+          while (true){
 
-            if (score <= aspAlpha){
-                aspAlpha = std::max(aspAlpha - aspDelta, LOST_SCORE);
-            }else if( score >= aspBeta){
-                aspBeta  = std::min(aspBeta + aspDelta, -LOST_SCORE);
-            }else{
-                break;
-            }
+              int score = _rootMax(_initialBoard, aspAlpha, aspBeta, currDepth, pvIdx);
+
+              // moves that raised alpha go first, also for the re-search
+              std::stable_sort(_rootMoves.begin() + pvIdx, _rootMoves.end(),
+                               [](const RootMove &a, const RootMove &b){ return a.score > b.score; });
 
-            aspDelta += aspDelta * 2 / 3;
+              if (*_stop) break;
+
+              if (score <= aspAlpha){
+                  aspAlpha = std::max(aspAlpha - aspDelta[pvIdx], LOST_SCORE);
+              }else if( score >= aspBeta){
+                  aspBeta  = std::min(aspBeta + aspDelta[pvIdx], -LOST_SCORE);
+              }else{
+                  break;
+              }
+
+              aspDelta[pvIdx] += aspDelta[pvIdx] * 2 / 3;
+          }
         }
 
         // Iteration finished normally
         // Check and adjust time we should spend, and print UCI info
 
-        if (_stop) break;
+        if (*_stop) break;
+
+        _completedDepth = currDepth;
+
+        // Order of the rest root moves for the next iteration:
+        // moves that took more effort to refute go first
+        std::stable_sort(_rootMoves.begin() + multiPV, _rootMoves.end(),
+                         [](const RootMove &a, const RootMove &b){ return a.nodes > b.nodes; });
 
+        U64 bestNodes = 0;
+        for (auto &rm : _rootMoves){
+          if (rm.move == _bestMove) bestNodes = rm.totalNodes;
+        }
+
+        _checkPonderHit();
         int elapsed = 0;
-        bool shouldStop = _timer.finishOnThisDepth(&elapsed, _nodes, _rootNodesSpent[_bestMove.getPieceType()][_bestMove.getTo()]);
-        if (_logUci) {
-            _logUciInfo(_getPv(), currDepth, _bestScore, _nodes, elapsed);
+        bool shouldStop = _timer.finishOnThisDepth(&elapsed, _counter->getNodes(), bestNodes, _bestMove.getMoveINT(), _bestScore);
+        if (_iterationHook) _iterationHook(_bestMove, currDepth, _counter->getNodes(), elapsed);
+        if (_logUci && multiPV == 1) {
+            _logUciInfo(_getPv(), currDepth, _bestScore, getTotalNodes(), elapsed);
+        }else if (_logUci){
+            for (int i = 0; i < multiPV; i++){
+              _logUciInfo(_getPv(_rootMoves[i].pv), currDepth, _rootMoves[i].score, getTotalNodes(), elapsed, i + 1);
+            }
         }
 
         if (shouldStop) break;
 
     }
 
-  // It can be the case where we exited before finishing iteration, and our PV etc can changed.
-  // So update search info one more time
-  if (_logUci) _logUciInfo(_getPv(), maxDepthSearched, _bestScore, _nodes, _timer.getElapsed());
+  // While pondering bestmove can not be sent before "stop" or "ponderhit"
+  while (_timer.isPondering() && !*_stop){
+    _checkPonderHit();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
 
-  if (_logUci) std::cout << "bestmove " << getBestMove().getNotation(_initialBoard.getFrcMode()) << std::endl;
+  // Main thread is done: stop all helpers with the shared stop signal
+  if (_threadId == 0) *_stop = true;
 
   if (_logUci){
 
-    //send all other thread stop signal
-    for (int i = 1; i < myTHREADSCOUNT; i++){
-      if ( cSearch[i] != nullptr){
-        cSearch[i]->stop();
-      }
-    }
-
-    // wait for extra threads
+    // bestmove is sent only when all threads are finished
     for (int i = 1; i < myTHREADSCOUNT; i++){
       if (cThread[i].joinable()){
         cThread[i].join();
       }
     }
 
-    // threads finished, delete extensive Searches
+    U64 ttProbes = 0, ttHits = 0;
+    for (int i = 0; i < myTHREADSCOUNT; i++){
+      ttProbes += cCounters[i].getTTProbes();
+      ttHits   += cCounters[i].getTTHits();
+    }
+    Stats::collect(myTHREADSCOUNT, ttProbes, ttHits);
+
+    std::vector<Search *> threads = {this};
     for (int i = 1; i < myTHREADSCOUNT; i++){
-      delete cSearch[i];
-      cSearch[i] = nullptr;
+      if (cSearch[i] != nullptr) threads.push_back(cSearch[i]);
     }
+    Search * best = selectBestThread(threads);
+
+    // It can be the case where we exited before finishing iteration, and our PV etc can changed.
+    // So update search info one more time
+    int depth = best == this ? maxDepthSearched : best->_completedDepth;
+    _logUciInfo(best->_getPv(), depth, best->_bestScore, getTotalNodes(), _timer.getElapsed());
+
+    std::cout << "bestmove " << best->getBestMove().getNotation(_initialBoard.getFrcMode());
+    Move ponderMove = best->_getPonderMove();
+    if (!(ponderMove.getFlags() & Move::NULL_MOVE)){
+      std::cout << " ponder " << ponderMove.getNotation(_initialBoard.getFrcMode());
+    }
+    std::cout << std::endl;
+  }
+
+}
+
+MoveList Search::getPv() {
+  return _getPv(_ourPV);
 }
 
+int Search::getCompletedDepth() {
+  return _completedDepth;
 }
 
 MoveList Search::_getPv() {
+  return _getPv(_ourPV);
+}
+
+MoveList Search::_getPv(const pV &line) {
   MoveList pv;
-  for (int i = 0; i < _ourPV.length; i++){
-    pv.push_back(Move(_ourPV.pVmoves[i]));
+  for (int i = 0; i < line.length; i++){
+    pv.push_back(Move(line.pVmoves[i]));
   }
 
   return pv;
 }
 
-void Search::_logUciInfo(const MoveList &pv, int depth, int bestScore, U64 nodes, int elapsed) {
+void Search::_initRootMoves() {
+  const HASH_Entry ttEntry = _hash->HASH_Get(_initialBoard.getZKey().getValue());
+  int hashMove = ttEntry.Flag != NONE ? ttEntry.move : 0;
+
+  MovePicker movePicker(&_orderingInfo, &_initialBoard, hashMove, _initialBoard.getActivePlayer(), 0, 0, 0);
+
+  _rootMoves.clear();
+  while (movePicker.hasNext()){
+    Move move = movePicker.getNext();
+    Board movedBoard = _initialBoard;
+    if (movedBoard.doMove(move)){
+      _rootMoves.push_back(RootMove(move));
+    }
+  }
+
+  // "go searchmoves": keep only requested moves,
+  // if none of them is legal search all moves
+  const std::vector<int> &searchMoves = _limits.searchMoves;
+  std::vector<RootMove> filtered;
+  for (auto &rm : _rootMoves){
+    if (std::find(searchMoves.begin(), searchMoves.end(), rm.move.getMoveINT()) != searchMoves.end()){
+      filtered.push_back(rm);
+    }
+  }
+  if (!filtered.empty()) _rootMoves = filtered;
+}
+
+void Search::_rootProbeTB() {
+  _tbCardinality = std::min(_limits.syzygyProbeLimit, Syzygy::maxPieces());
+  _rootInTB = false;
+
+  if (_tbCardinality <= 0 || _rootMoves.empty() || _initialBoard.getCastlingRights()
+      || _popCount(_initialBoard.getOccupied()) > _tbCardinality){
+    return;
+  }
+
+  // DTZ keeps the win under the 50-move rule, WDL only knows the result
+  bool dtzAvailable = true;
+  _rootInTB = Syzygy::rootProbe(_initialBoard, _rootMoves);
+  if (!_rootInTB){
+    dtzAvailable = false;
+    _rootInTB = Syzygy::rootProbeWdl(_initialBoard, _rootMoves);
+  }
+
+  if (!_rootInTB){
+    for (auto &rm : _rootMoves){
+      rm.tbRank = 0;
+      rm.tbScore = 0;
+    }
+    return;
+  }
+
+  _counter->AddTBHits(_rootMoves.size());
+
+  // Search only the moves that keep the best tablebase result
+  std::stable_sort(_rootMoves.begin(), _rootMoves.end(),
+                   [](const RootMove &a, const RootMove &b){ return a.tbRank > b.tbRank; });
+  int bestRank = _rootMoves[0].tbRank;
+  _rootMoves.erase(std::remove_if(_rootMoves.begin(), _rootMoves.end(),
+                                  [bestRank](const RootMove &rm){ return rm.tbRank < bestRank; }),
+                   _rootMoves.end());
+
+  // With DTZ root moves are already correct, probing in search would
+  // only make the engine play for the WDL result, not the fastest zeroing.
+  // In a lost or drawn position search can still pick the most stubborn move
+  if (dtzAvailable || _rootMoves[0].tbScore <= 0) _tbCardinality = 0;
+}
+
+void Search::_logUciInfo(const MoveList &pv, int depth, int bestScore, U64 nodes, int elapsed, int multiPV) {
   std::string pvString;
 
+  // Search can not see the tablebase win behind the 50-move counter reset,
+  // so root tablebase score is reported instead of the search one
+  if (_rootInTB && abs(bestScore) < WON_IN_X && !pv.empty()){
+    for (auto &rm : _rootMoves){
+      if (rm.move == pv[0]){
+        bestScore = rm.tbScore;
+        break;
+      }
+    }
+  }
+
   for (auto move : pv) {
     pvString += move.getNotation(_initialBoard.getFrcMode()) + " ";
   }
@@ -188,19 +383,18 @@ void Search::_logUciInfo(const MoveList &pv, int depth, int bestScore, U64 nodes
   // Avoid _selDepth being smaller than depth when entire path to score is in TT
   _selDepth = std::max(depth, _selDepth);
 
-  //collect info about nodes and seldepth from all Threads
+  //collect info about seldepth from all Threads
   for (int i = 1; i < myTHREADSCOUNT; i++){
-    if (cSearch[i] != nullptr){
-      nodes += cSearch[i]->getNodes();
-      _selDepth = std::max(cSearch[i]->getSeldepth(), _selDepth);
-    }
+    _selDepth = std::max(cCounters[i].getSelDepth(), _selDepth);
   }
 
   std::cout << "info depth " + std::to_string(depth) + " ";
   std::cout << "seldepth " + std::to_string(_selDepth) + " ";
+  if (multiPV > 0) std::cout << "multipv " + std::to_string(multiPV) + " ";
   std::cout << "nodes " + std::to_string(nodes) + " ";
   std::cout << "score " + scoreString + " ";
-  std::cout << "nps " + std::to_string((nodes / elapsed) * 1000)  + " ";
+  std::cout << "nps " + std::to_string(nodes * 1000 / elapsed)  + " ";
+  std::cout << "tbhits " + std::to_string(getTotalTBHits()) + " ";
   std::cout << "time " + std::to_string(elapsed) + " ";
   std::cout << "pv " + pvString;
   std::cout << std::endl;
@@ -218,32 +412,164 @@ void Search::_populateFinnyTable(){
 }
 
 void Search::stop() {
-  _stop = true;
+  *_stop = true;
+}
+
+void Search::setStopSignal(std::atomic<bool> * signal) {
+  _stop = signal;
+}
+
+void Search::ponderHit() {
+  _ponderHit = true;
+}
+
+inline void Search::_checkPonderHit() {
+  if (_ponderHit){
+    _ponderHit = false;
+    _timer.ponderHit();
+  }
+}
+
+Move Search::_getPonderMove() {
+  if (_bestMove.getFlags() & Move::NULL_MOVE) return Move();
+
+  Board movedBoard = _initialBoard;
+  movedBoard.doMove(_bestMove);
+
+  int candidate = 0;
+  if (_ourPV.length >= 2 && _ourPV.pVmoves[0] == _bestMove.getMoveINT()){
+    candidate = _ourPV.pVmoves[1];
+  }else{
+    const HASH_Entry ttEntry = _hash->HASH_Get(movedBoard.getZKey().getValue());
+    if (ttEntry.Flag != NONE) candidate = ttEntry.move;
+  }
+
+  // make sure move is legal in the position after best move
+  MoveList moves;
+  MoveGen(&movedBoard, false, &moves);
+  for (auto &move : moves){
+    Board replyBoard = movedBoard;
+    if (move.getMoveINT() == candidate && replyBoard.doMove(move)){
+      return move;
+    }
+  }
+
+  return Move();
 }
 
 Move Search::getBestMove() {
   return _bestMove;
 }
 
-int Search::getNodes(){
-  return _nodes;
+Search * Search::selectBestThread(const std::vector<Search *> &threads){
+  Search * best = threads[0];
+
+  // MultiPV output is taken from the main thread only
+  if (threads.size() < 2 || best->_limits.multiPV > 1) return best;
+
+  int minScore = INF;
+  for (auto th : threads){
+    if (th->_completedDepth > 0) minScore = std::min(minScore, th->_bestScore);
+  }
+
+  // every thread votes for its move with its score over the worst one,
+  // weighted by the depth it completed
+  std::unordered_map<int, U64> votes;
+  for (auto th : threads){
+    if (th->_completedDepth > 0){
+      votes[th->_bestMove.getMoveINT()] += (U64) (th->_bestScore - minScore + VOTE_SCORE_BASE) * th->_completedDepth;
+    }
+  }
+
+  for (auto th : threads){
+    if (th->_completedDepth == 0) continue;
+    if (best->_completedDepth == 0){
+      best = th;
+      continue;
+    }
+
+    U64 thVotes   = votes[th->_bestMove.getMoveINT()];
+    U64 bestVotes = votes[best->_bestMove.getMoveINT()];
+
+    // found mate is taken as is, the shortest one wins
+    if (best->_bestScore >= WON_IN_X){
+      if (th->_bestScore > best->_bestScore) best = th;
+    }else if (th->_bestScore >= WON_IN_X
+              || thVotes > bestVotes
+              || (thVotes == bestVotes && th->_completedDepth > best->_completedDepth)){
+      best = th;
+    }
+  }
+
+  return best;
+}
+
+U64 Search::getNodes(){
+  return _counter->getNodes();
 }
 
 int Search::getSeldepth(){
   return _selDepth;
 }
 
+U64 Search::getTTProbes(){
+  return _counter->getTTProbes();
+}
+
+U64 Search::getTTHits(){
+  return _counter->getTTHits();
+}
+
+void Search::setHashTable(HASH * hash){
+  _hash = hash;
+}
+
+void Search::setStandalone(){
+  _standalone = true;
+}
+
+void Search::setIterationHook(IterationHook hook){
+  _iterationHook = hook;
+}
+
+U64 Search::getTotalNodes(){
+  U64 nodes = 0;
+  for (int i = 0; i < myTHREADSCOUNT; i++){
+    nodes += cCounters[i].getNodes();
+  }
+  return nodes;
+}
+
+U64 Search::getTotalTBHits(){
+  U64 hits = 0;
+  for (int i = 0; i < myTHREADSCOUNT; i++){
+    hits += cCounters[i].getTBHits();
+  }
+  return hits;
+}
+
 int Search::getBestScore(){
   return _bestScore;
 }
 
 bool Search::_checkLimits() {
 
-  if (_nodes % 2048 != 0) {
+  // Main thread is the only timekeeper, helpers are stopped by it
+  if (_threadId != 0 && !_standalone) return false;
+
+  U64 nodes = _counter->getNodes();
+  if (nodes < _nextLimitCheck) {
     return false;
   }
 
-  return _timer.checkLimits(_nodes);
+  _checkPonderHit();
+
+  // Node budget is shared by all threads,
+  // sum other counters only when it is actually used
+  bool limitReached = _timer.checkLimits(_timer.hasNodeLimit() && !_standalone ? getTotalNodes() : nodes);
+  _nextLimitCheck = nodes + _timer.getPollInterval(nodes);
+
+  return limitReached;
 }
 
 inline int Search::_makeCmhBonus(int bonus){
@@ -296,68 +622,73 @@ inline bool Search::_isRepetitionDraw(U64 currKey, int untillFifty){
 }
 
 inline int Search::_makeDrawScore(){
-    return (_nodes & 0x7);
+    return (_counter->getNodes() & 0x7);
 }
 
-int Search::_rootMax(const Board &board, int alpha, int beta, int depth) {
-  _nodes++;
+int Search::_rootMax(const Board &board, int alpha, int beta, int depth, int pvIdx) {
+  _counter->AddNode();
   int nodeEval = Eval::evaluate(board, board.getActivePlayer());
-  int hashMove = 0;
   int currScore;
   pV rootPV = pV();
   Move bestMove;
   bool fullWindow = true;
 
-  // Load TT
-  const HASH_Entry ttEntry = myHASH->HASH_Get(board.getZKey().getValue());
-  hashMove = ttEntry.Flag != NONE ? ttEntry.move : 0;
-
   _sStack.AddEval(nodeEval);
 
-  MovePicker movePicker(&_orderingInfo, &board, hashMove, board.getActivePlayer(), 0, 0, 0);
+  for (size_t i = pvIdx; i < _rootMoves.size(); i++){
+    _rootMoves[i].score = -INF;
+  }
 
-  while (movePicker.hasNext()) {
-    Move move = movePicker.getNext();
+  // Root moves are legal and already ordered: best moves of the previous
+  // iteration first, then by nodes spent on them.
+  // Moves before pvIdx are already reported as better PV lines.
+  for (size_t i = pvIdx; i < _rootMoves.size(); i++) {
+    RootMove * rm = &_rootMoves[i];
+    Move move = rm->move;
 
     Board movedBoard = board;
-    bool isLegal = movedBoard.doMove(move);
+    movedBoard.doMove(move);
 
-    if (isLegal){
-        myHASH->HASH_Prefetch(movedBoard.getZKey().getValue());
-        _sStack.AddMove(move);
-        U64 nodesStart = _nodes;
+    _hash->HASH_Prefetch(movedBoard.getZKey().getValue());
+    _sStack.AddMove(move);
+    U64 nodesStart = _counter->getNodes();
 
-        if (fullWindow) {
-          currScore = -_negaMax(movedBoard, &rootPV, depth - 1, -beta, -alpha, false, false);
-        } else {
-          currScore = -_negaMax(movedBoard, &rootPV, depth - 1, -alpha - 1, -alpha,  false, true);
-          if (currScore > alpha) currScore = -_negaMax(movedBoard, &rootPV, depth - 1, -beta, -alpha, false, false);
-        }
+    if (fullWindow) {
+      currScore = -_negaMax(movedBoard, &rootPV, depth - 1, -beta, -alpha, false, false);
+    } else {
+      currScore = -_negaMax(movedBoard, &rootPV, depth - 1, -alpha - 1, -alpha,  false, true);
+      if (currScore > alpha) currScore = -_negaMax(movedBoard, &rootPV, depth - 1, -beta, -alpha, false, false);
+    }
 
-        if (_stop || _checkLimits()) {
-          _stop = true;
-          break;
-        }
+    if (*_stop || _checkLimits()) {
+      *_stop = true;
+      break;
+    }
 
-        // If the current score is better than alpha, or this is the first move in the loop
-        if (currScore > alpha) {
-          fullWindow = false;
-          bestMove = move;
-          alpha = currScore;
-          _ourPV.length = rootPV.length + 1;
-          _ourPV.pVmoves[0] = move.getMoveINT();
-          // memcpy - (куда, откуда, длина)
-          std::memcpy(_ourPV.pVmoves + 1, rootPV.pVmoves, sizeof(int) * rootPV.length);
-          // Break if we've found a checkmate
-        }
-        _rootNodesSpent[move.getPieceType()][move.getTo()] += _nodes - nodesStart;
-        _sStack.Remove();
+    // If the current score is better than alpha, or this is the first move in the loop
+    if (currScore > alpha) {
+      fullWindow = false;
+      bestMove = move;
+      alpha = currScore;
+      pV line = pV();
+      line.length = rootPV.length + 1;
+      line.pVmoves[0] = move.getMoveINT();
+      // memcpy - (куда, откуда, длина)
+      std::memcpy(line.pVmoves + 1, rootPV.pVmoves, sizeof(int) * rootPV.length);
+      if (pvIdx == 0) _ourPV = line;
+      rm->score = currScore;
+      rm->pv = line;
+      // Break if we've found a checkmate
     }
+    rm->nodes      += _counter->getNodes() - nodesStart;
+    rm->totalNodes += _counter->getNodes() - nodesStart;
+    _sStack.Remove();
 
   }
 
-  if (!_stop && !(bestMove.getFlags() & Move::NULL_MOVE)) {
-    myHASH->HASH_Store(board.getZKey().getValue(), bestMove.getMoveINT(), EXACT, true, alpha, depth, 0);
+  // only the first PV line is the real result of the root search
+  if (!*_stop && !(bestMove.getFlags() & Move::NULL_MOVE) && pvIdx == 0) {
+    _hash->HASH_Store(board.getZKey().getValue(), bestMove.getMoveINT(), EXACT, true, alpha, depth, 0);
     _bestMove = bestMove;
     _bestScore = alpha;
   }
@@ -395,10 +726,11 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
 
   bool isPmQuietCounter = (pMoveScore >= 50000 && pMoveScore <= 200000);
 
-  _nodes++;
+  _counter->AddNode();
+  STATS_ADD(ST_NODES);
   // Check if we are out of time
-  if (_stop || _checkLimits()) {
-    _stop = true;
+  if (*_stop || _checkLimits()) {
+    *_stop = true;
     return 0;
   }
 
@@ -414,7 +746,10 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
   // Go into the QSearch if depth is 0 and we are not in check
   // Cut out pV and update our seldepth before dropping into qSearch
   if ((depth <= 0 && !incheckNode) || ply >= MAX_PLY) {
-    _selDepth = std::max(ply, _selDepth);
+    if (ply > _selDepth){
+      _selDepth = ply;
+      _counter->setSelDepth(ply);
+    }
     return _qSearch(board, alpha, beta);
   }
 
@@ -425,7 +760,8 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
 
     // Check transposition table cache
   // If TT is causing a cuttoff, we update move ordering stuff
-  const HASH_Entry ttEntry = myHASH->HASH_Get(board.getZKey().getValue());
+  const HASH_Entry ttEntry = _hash->HASH_Get(board.getZKey().getValue());
+  _counter->AddTTProbe(ttEntry.Flag != NONE);
   if (ttEntry.Flag != NONE){
     ttNode = true;
     ttMove = Move(ttEntry.move);
@@ -439,20 +775,48 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
       }
 
       if (ttEntry.Flag & EXACT){
+        STATS_ADD(ST_TT_CUTOFF);
         return hashScore;
       }
       if (ttEntry.Flag & BETA && hashScore >= beta){
+        STATS_ADD(ST_TT_CUTOFF);
         int bonus = _getHistoryBonus(depth, 0, 0);
         _updateBeta(qttNode, ttMove, board.getActivePlayer(), pMove, ppMove, ply, bonus);
         return beta;
       }
 
       if (ttEntry.Flag & ALPHA && hashScore <= alpha){
+        STATS_ADD(ST_TT_CUTOFF);
         return alpha;
       }
     }
   }
 
+  // Probe endgame tablebases
+  // Only positions just after a capture or pawn move are probed: WDL does not
+  // know the 50-move counter. Result is exact, so it is stored in TT with
+  // a bigger depth to be reused. Not done in the singular search: it would
+  // cut off the same position the excluded move is tested in
+  if (_tbCardinality > 0 && !singSearch && board.getHalfmoveClock() == 0 && !board.getCastlingRights()
+      && _popCount(board.getOccupied()) <= _tbCardinality){
+    Syzygy::ProbeState tbState;
+    int wdl = Syzygy::probeWdl(board, &tbState);
+
+    if (tbState != Syzygy::FAIL){
+      _counter->AddTBHits(1);
+
+      int tbScore = wdl < -1 ? -TB_WIN_SCORE + ply
+                  : wdl >  1 ?  TB_WIN_SCORE - ply
+                  : 2 * wdl;
+      CutOffState tbBound = wdl < -1 ? ALPHA : wdl > 1 ? BETA : EXACT;
+
+      if (tbBound == EXACT || (tbBound == BETA && tbScore >= beta) || (tbBound == ALPHA && tbScore <= alpha)){
+        _hash->HASH_Store(board.getZKey().getValue(), ttEntry.move, tbBound, ttPv, tbScore, std::min(MAX_PLY - 1, depth + 6), ply);
+        return tbBound == BETA ? beta : tbBound == ALPHA ? alpha : tbScore;
+      }
+    }
+  }
+
   // Statically evaluate our position
   // Do the Evaluation, unless we are in check or prev move was NULL
   // If last Move was Null, just negate prev eval and add 2x tempo bonus (10)
@@ -507,6 +871,7 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
           _posHist.Add(board.getZKey().getValue());
           _sStack.AddNullMove(getOppositeColor(board.getActivePlayer()));
           movedBoard.doNool();
+          STATS_ADD(ST_NMP_TRY);
 
           int fDepth = depth - NULL_MOVE_REDUCTION - depth / 4 - std::min((nodeEval - beta) / 128, 5);
           int score = -_negaMax(movedBoard, &thisPV, fDepth , -beta, -beta + 1, false, false);
@@ -515,6 +880,7 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
           _sStack.RemoveNull(behindColor, nmpTree);
 
           if (score >= beta){
+            STATS_ADD(ST_NMP_CUT);
             return beta;
           }
           fnNode = true;
@@ -561,6 +927,7 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
 
                 // if it holds, do proper reduced search
                 if(qScore >= pcBeta){
+                    STATS_ADD(ST_PROBCUT_TRY);
                     _posHist.Add(board.getZKey().getValue());
                     _sStack.AddMove(move);
 
@@ -570,6 +937,7 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
                     _sStack.Remove();
 
                     if (sScore >= pcBeta){
+                        STATS_ADD(ST_PROBCUT_CUT);
                         return beta;
                     }
                 }
@@ -635,7 +1003,9 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
               int sDepth = depth / 2;
               int sBeta = ttEntry.score - depth;
               int score = depth > 5 ? _negaMax(board, &thisPV, sDepth, sBeta - 1, sBeta, true, cutNode) : nodeEval;
+              STATS_ADD(depth > 5 ? ST_SINGULAR_TRY : ST_SINGEVAL_TRY);
               if (sBeta > score){
+                STATS_ADD(depth > 5 ? ST_SINGULAR_EXT : ST_SINGEVAL_EXT);
                 tDepth += 1 + (!pvNode && depth > 5);
                 singNode = true;
               }else if(!incheckNode && depth > 5 && ttEntry.score >= beta){
@@ -671,7 +1041,7 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
     Board movedBoard = board;
     bool isLegal = movedBoard.doMove(move);
     if (isLegal){
-        myHASH->HASH_Prefetch(movedBoard.getZKey().getValue());
+        _hash->HASH_Prefetch(movedBoard.getZKey().getValue());
         bool doLMR = false;
         legalCount++;
         int score;
@@ -749,6 +1119,7 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
           //Search with reduced depth around alpha in assumtion
           // that alpha would not be beaten here
           score = -_negaMax(movedBoard, &thisPV, fDepth, -alpha - 1 , -alpha, false, true);
+          STATS_ADD(ST_LMR_SEARCH);
         }
 
         // Code here is restructured based on Weiss
@@ -760,6 +1131,7 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
         // So for both of this cases we do limited window search.
         if (doLMR){
           if (score > alpha){
+            STATS_ADD(ST_LMR_RESEARCH);
             score = -_negaMax(movedBoard, &thisPV, tDepth - 1, -alpha - 1, -alpha, false, !cutNode);
           }
         } else if (!pvNode || legalCount > 1){
@@ -789,11 +1161,11 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
             _orderingInfo.incrementCounterHistory(1, board.getActivePlayer(), ppMove, move.getPieceType(), move.getTo(), _makeCmhBonus(bonus));
           }
           // Add a new tt entry for this node
-          if (!_stop && !singSearch){
-            myHASH->HASH_Store(board.getZKey().getValue(), move.getMoveINT(), BETA, ttPv, score, depth, ply);
+          if (!*_stop && !singSearch){
+            _hash->HASH_Store(board.getZKey().getValue(), move.getMoveINT(), BETA, ttPv, score, depth, ply);
           }
           // we updated beta and in the pVNode so we should update our pV
-          if (pvNode && !_stop){
+          if (pvNode && !*_stop){
             up_pV->length = thisPV.length + 1;
             up_pV->pVmoves[0] = move.getMoveINT();
             // memcpy - (куда, откуда, длина)
@@ -808,7 +1180,7 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
           alpha = score;
           bestMove = move;
           // we updated alpha and in the pVNode so we should update our pV
-          if (pvNode && !_stop){
+          if (pvNode && !*_stop){
             up_pV->length = thisPV.length + 1;
             up_pV->pVmoves[0] = move.getMoveINT();
             // memcpy - (куда, откуда, длина)
@@ -838,12 +1210,12 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
   }
 
   // Store bestScore in transposition table
-  if (!_stop && !singSearch){
+  if (!*_stop && !singSearch){
       if (alpha <= alphaOrig) {
         int saveMove = ttMove.getMoveINT() != 0 ? ttMove.getMoveINT() : 0;
-        myHASH->HASH_Store(board.getZKey().getValue(),  saveMove, ALPHA, ttPv, alpha, depth, ply);
+        _hash->HASH_Store(board.getZKey().getValue(),  saveMove, ALPHA, ttPv, alpha, depth, ply);
       } else {
-        myHASH->HASH_Store(board.getZKey().getValue(), bestMove.getMoveINT(), EXACT, ttPv, alpha, depth, ply);
+        _hash->HASH_Store(board.getZKey().getValue(), bestMove.getMoveINT(), EXACT, ttPv, alpha, depth, ply);
       }
   }
 
@@ -851,14 +1223,15 @@ int Search::_negaMax(Board &board, pV *up_pV, int depth, int alpha, int beta, bo
 }
 
 int Search::_qSearch(Board &board, int alpha, int beta) {
-   _nodes++;
+   _counter->AddNode();
+   STATS_ADD(ST_QNODES);
    bool pvNode = alpha != beta - 1;
    bool ttPv = pvNode;
    int nodeEval = NOSCORE;
    int standPat = NOSCORE;
 
-  if (_stop || _checkLimits()) {
-    _stop = true;
+  if (*_stop || _checkLimits()) {
+    *_stop = true;
     return 0;
   }
 
@@ -878,7 +1251,8 @@ int Search::_qSearch(Board &board, int alpha, int beta) {
 
   // Check transposition table cache
   // If TT is causing a cuttoff, we update move ordering stuff
-  const HASH_Entry ttEntry = myHASH->HASH_Get(board.getZKey().getValue());
+  const HASH_Entry ttEntry = _hash->HASH_Get(board.getZKey().getValue());
+  _counter->AddTTProbe(ttEntry.Flag != NONE);
   if (ttEntry.Flag != NONE){
     if (!pvNode){
       int hashScore = ttEntry.score;
@@ -888,12 +1262,15 @@ int Search::_qSearch(Board &board, int alpha, int beta) {
         hashScore = (hashScore > 0) ? (hashScore - MAX_PLY) :  (hashScore + MAX_PLY);
       }
       if (ttEntry.Flag & EXACT){
+        STATS_ADD(ST_TT_CUTOFF);
         return hashScore;
       }
       if (ttEntry.Flag & BETA && hashScore >= beta){
+        STATS_ADD(ST_TT_CUTOFF);
         return beta;
       }
       if (ttEntry.Flag & ALPHA && hashScore <= alpha){
+        STATS_ADD(ST_TT_CUTOFF);
         return alpha;
       }
     }
@@ -918,13 +1295,13 @@ int Search::_qSearch(Board &board, int alpha, int beta) {
     bool isLegal = movedBoard.doMove(move);
 
     if (isLegal){
-          myHASH->HASH_Prefetch(movedBoard.getZKey().getValue());
+          _hash->HASH_Prefetch(movedBoard.getZKey().getValue());
 
           int score = -_qSearch(movedBoard, -beta, -alpha);
           if (score >= beta) {
             // Add a new tt entry for this node
-            if (!_stop){
-                myHASH->HASH_Store(board.getZKey().getValue(), move.getMoveINT(), BETA, ttPv, score, 0, MAX_PLY);
+            if (!*_stop){
+                _hash->HASH_Store(board.getZKey().getValue(), move.getMoveINT(), BETA, ttPv, score, 0, MAX_PLY);
             }
             return beta;
           }
@@ -25,8 +25,11 @@
 #include "orderinginfo.h"
 #include "timer.h"
 #include "finnyentry.h"
+#include "stats.h"
 #include <chrono>
+#include <functional>
 #include <atomic>
+#include <vector>
 
 /**
  * @brief Represents a search through a minmax tree.
@@ -46,8 +49,24 @@ class Search {
    * occurred in the game
    * @param logUci If logUci is set, UCI info commands about the search will be printed
    * to standard output in real time.k
+   * @param threadId index of the search thread, selects its node counter
    */
-  Search(const Board &, Limits, Hist, OrderingInfo *, bool= true);
+  Search(const Board &, Limits, const Hist &, OrderingInfo *, bool= true, int= 0);
+
+  /**
+   * @brief Prepares this Search for a new search from the given position.
+   *
+   * Search keeps its Finny table, accumulator caches and ordering info between
+   * searches. If the new position continues the game of the previous search,
+   * killers are shifted and only new game history entries are copied,
+   * root accumulator is rebuilt from the Finny table using board difference.
+   *
+   * @param board The board to search
+   * @param limits limits imposed on this search
+   * @param positionHistory Vector of ZKeys reprenting all positions that have
+   * occurred in the game
+   */
+  void setPosition(const Board &, Limits, const Hist &);
 
   /**
    * @brief Performs an iterative deepening search within the constraints of the given limits.
@@ -60,6 +79,19 @@ class Search {
    */
   Move getBestMove();
 
+  /**
+   * @brief Picks the search thread whose best move should be played.
+   *
+   * Threads vote for their best moves, vote of a thread is its score above
+   * the worst score of all threads, multiplied by the depth it completed.
+   * Move with the most votes wins, a found mate is always preferred.
+   * Should be called only after all threads are finished.
+   *
+   * @param threads Searches of the same position, main thread first
+   * @return Thread with the move to play
+   */
+  static Search * selectBestThread(const std::vector<Search *> &);
+
   /**
    * @brief Returns the score of the best move
    * @return Score of the best move from previous iteration
@@ -67,22 +99,109 @@ class Search {
   int getBestScore();
 
   /**
-   * @brief Instructs this Search to stop as soon as possible.
+   * @brief Instructs this Search (and all searches sharing its stop signal)
+   * to stop as soon as possible.
    */
   void stop();
 
+  /**
+   * @brief Makes this search use the given stop signal,
+   * shared by all threads searching the same position.
+   *
+   * @param signal Stop signal to use
+   */
+  void setStopSignal(std::atomic<bool> *);
+
+  /**
+   * @brief Tells pondering Search that the expected move was played,
+   * search continues with the normal time allocation.
+   */
+  void ponderHit();
+
   /**
    * @brief get amount of nodes we spent searching
    */
-  int getNodes();
+  U64 getNodes();
 
   /**
    * @brief get selective depth of the search thread
    */
   int getSeldepth();
 
+  /**
+   * @brief get the last depth this search thread completed
+   */
+  int getCompletedDepth();
+
+  /**
+   * @brief Returns the principal variation of the last search
+   */
+  MoveList getPv();
+
+  /**
+   * @brief get amount of nodes spent by all search threads
+   */
+  static U64 getTotalNodes();
+
+  /**
+   * @brief get amount of tablebase hits of all search threads
+   */
+  static U64 getTotalTBHits();
+
+  /**
+   * @brief get transposition table probes and hits of this search
+   */
+  U64 getTTProbes();
+  U64 getTTHits();
+
+  /**
+   * @brief Makes this search use its own transposition table
+   * instead of the global one.
+   *
+   * @param hash Transposition table to use
+   */
+  void setHashTable(HASH *);
+
+  /**
+   * @brief Makes this search independent of other search threads.
+   *
+   * Standalone search checks its limits against its own node count
+   * and does not skip depths, whatever its thread index is.
+   * Used when threads search different positions.
+   */
+  void setStandalone();
+
+  /**
+   * @brief Type of the function called after every completed iteration
+   * with the best move, depth, nodes and elapsed time (ms) of the search
+   */
+  typedef std::function<void(Move, int, U64, int)> IterationHook;
+
+  /**
+   * @brief Sets function to call after every completed iteration
+   *
+   * @param hook Function to call, empty function disables it
+   */
+  void setIterationHook(IterationHook);
+
  private:
 
+  /**
+   * @brief Largest number of pieces to probe tablebases for in the search,
+   * 0 if search does not probe
+   */
+  int _tbCardinality = 0;
+
+  /**
+   * @brief Called after every completed iteration, if set
+   */
+  IterationHook _iterationHook;
+
+  /**
+   * @brief True if root moves were ranked by tablebases
+   */
+  bool _rootInTB = false;
+
   /**
    * @brief Array of reductions applied to the branch during
    * LATE MOVE REDUCTION during AB-search
@@ -95,13 +214,21 @@ class Search {
    */
   int _lmp_Array[MAX_PLY][2];
 
-  U64 _rootNodesSpent[6][64];
+  /**
+   * @brief True if this search is not a part of a shared (Lazy SMP) search
+   */
+  bool _standalone = false;
 
   /**
    * @brief that is showing maxDepth with extentions we reached in the search
    */
   int _selDepth = 0;
 
+  /**
+   * @brief Last depth this search finished completely
+   */
+  int _completedDepth = 0;
+
   //search_constants
   //
   const int NULL_MOVE_REDUCTION = 4;
@@ -109,6 +236,8 @@ class Search {
 
   const int REVF_MOVE_CONST = 150;
   const int RAZORING_MARGIN = 945;
+
+  static const int VOTE_SCORE_BASE = 14;
   //
 
   /**
@@ -131,6 +260,25 @@ class Search {
    */
   OrderingInfo & _orderingInfo;
 
+  /**
+   * @brief Transposition table used by this search
+   */
+  HASH * _hash;
+
+  /**
+   * @brief Limits imposed on this search
+   */
+  Limits _limits;
+
+  /**
+   * @brief Legal moves of the root position.
+   *
+   * Legality is checked once per search. After each iteration moves are
+   * sorted by score, so first _limits.multiPV moves are principal variations
+   * of the search, the rest are sorted by nodes spent on them.
+   */
+  std::vector<RootMove> _rootMoves;
+
   /**
    * @brief Timer that is controlling time management and testing to not over
    * overstep depth/nodes/etc bounds
@@ -148,28 +296,66 @@ class Search {
    */
   bool _logUci;
 
+  /**
+   * @brief Own stop flag, used when search is not a part of a thread group
+   */
+  std::atomic<bool> _ownStop;
+
   /**
    * @brief If this flag is set, calls to _negaMax() and _rootMax() will end as soon
    * as possible and calls to _rootMax will not set the best move and best score.
+   *
+   * Points to the stop signal shared by all threads searching the same position,
+   * so stopping any of them (or main thread finishing) stops all of them.
    */
-  std::atomic<bool> _stop;
+  std::atomic<bool> * _stop;
+
+  /**
+   * @brief Set by UCI thread on ponderhit, handled by the search thread.
+   */
+  std::atomic<bool> _ponderHit;
+
+  /**
+   * @brief Switches timer out of pondering if ponderhit was received
+   */
+  inline void _checkPonderHit();
+
+  /**
+   * @brief Returns move to ponder on: second move of the PV,
+   * or TT move of the position after best move.
+   */
+  Move _getPonderMove();
 
 
   /**
    * @brief Returns True if this search has exceeded its given limits
    *
-   * Note that to avoid a needless amount of computation, limits are only
-   * checked every 4096 calls to _checkLimits() (using the Search::_limitCheckCount property).
-   * If Search::_limitCheckCount is not 0, false will be returned.
+   * Only the main search thread checks limits, helpers are stopped by it.
+   * To avoid a needless amount of computation, limits are only
+   * checked when node counter reaches Search::_nextLimitCheck,
+   * poll interval is adapted to the search speed by the Timer.
    *
    * @return True if this search has exceed its limits, true otherwise
    */
   bool _checkLimits();
 
   /**
-   * @brief Number of nodes searched in the last search.
+   * @brief Node count at which limits are checked next time
+   */
+  U64 _nextLimitCheck;
+
+  /**
+   * @brief Counter of nodes searched in the last search.
+   *
+   * Points to the counter of this thread in the global counter array,
+   * so other threads can read it.
+   */
+  THREAD_Counter * _counter;
+
+  /**
+   * @brief Index of the search thread
    */
-  U64 _nodes;
+  int _threadId;
 
   /**
    * @brief Best move found on last search.
@@ -213,10 +399,28 @@ class Search {
    * Starts performing a search to the given depth using recursive minimax
    * with alpha-beta pruning.
    *
+   * Root moves that are already searched as better principal variations
+   * (_rootMoves before pvIdx) are skipped.
+   *
    * @param board Board to search through
    * @param depth Depth to search to
+   * @param pvIdx index of the principal variation searched
    */
-  int _rootMax(const Board &, int, int, int);
+  int _rootMax(const Board &, int, int, int, int);
+
+  /**
+   * @brief Fills _rootMoves with legal moves of the initial board,
+   * ordered by the move picker
+   */
+  void _initRootMoves();
+
+  /**
+   * @brief Ranks root moves by endgame tablebases, if the root position is in them.
+   *
+   * Moves that lose the best tablebase result are removed from _rootMoves,
+   * sets _tbCardinality used for probing in the search.
+   */
+  void _rootProbeTB();
 
   /**
    * @brief Non root negamax function, should only be called by _rootMax()
@@ -252,8 +456,9 @@ class Search {
    * @param bestScore Score corresponding to the best move
    * @param nodes     Number of nodes searched
    * @param elapsed   Time taken to complete the search in milliseconds
+   * @param multiPV   Number of the principal variation (not printed if 0)
    */
-  void _logUciInfo(const MoveList &, int, int, U64, int);
+  void _logUciInfo(const MoveList &, int, int, U64, int, int= 0);
 
   /**
    * @brief Returns the principal variation for the last performed search.
@@ -265,6 +470,11 @@ class Search {
    */
   MoveList _getPv();
 
+  /**
+   * @brief Returns the given principal variation as MoveList
+   */
+  MoveList _getPv(const pV &);
+
   /**
    * @brief this function calculates reductions values and stores
    * it in the _lmr_R_array
@@ -21,6 +21,7 @@
 #include "defs.h"
 #include "move.h"
 #include <cstdint>
+#include <atomic>
 
 struct SEARCH_Data
 {
@@ -77,6 +78,75 @@ struct Hist{
     };
 };
 
+/**
+ * @brief Search statistics of a single search thread.
+ *
+ * Only the owning thread writes its counter, other threads just read it,
+ * so relaxed loads/stores are enough and no locked instructions are needed.
+ * Counter takes a whole cache line to avoid false sharing between threads.
+ */
+struct alignas(64) THREAD_Counter{
+    std::atomic<U64> nodes;
+    std::atomic<U64> ttProbes;
+    std::atomic<U64> ttHits;
+    std::atomic<int> selDepth;
+    std::atomic<U64> tbHits;
+
+    THREAD_Counter() : nodes(0), ttProbes(0), ttHits(0), selDepth(0), tbHits(0) {};
+
+    void Reset(){
+      nodes.store(0, std::memory_order_relaxed);
+      ttProbes.store(0, std::memory_order_relaxed);
+      ttHits.store(0, std::memory_order_relaxed);
+      selDepth.store(0, std::memory_order_relaxed);
+      tbHits.store(0, std::memory_order_relaxed);
+    };
+
+    void AddNode(){
+      _increment(nodes);
+    };
+
+    // the only TT probe counters, bench and search statistics read them
+    void AddTTProbe(bool hit){
+      _increment(ttProbes);
+      if (hit) _increment(ttHits);
+    };
+
+    void AddTBHits(U64 n){
+      tbHits.store(tbHits.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    };
+
+    U64 getNodes() const{
+      return nodes.load(std::memory_order_relaxed);
+    };
+
+    U64 getTTProbes() const{
+      return ttProbes.load(std::memory_order_relaxed);
+    };
+
+    U64 getTTHits() const{
+      return ttHits.load(std::memory_order_relaxed);
+    };
+
+    U64 getTBHits() const{
+      return tbHits.load(std::memory_order_relaxed);
+    };
+
+    void setSelDepth(int d){
+      selDepth.store(d, std::memory_order_relaxed);
+    };
+
+    int getSelDepth() const{
+      return selDepth.load(std::memory_order_relaxed);
+    };
+
+  private:
+    // single writer - plain load + store, no need for locked add
+    static void _increment(std::atomic<U64> &c){
+      c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    };
+};
+
   struct pV {
     int     pVmoves [MAX_INT_PLY];
     uint8_t length;
@@ -84,5 +154,22 @@ struct Hist{
     pV () : pVmoves {0}, length(0) {};
   };
 
+  /**
+   * @brief Legal move of the root position with its score and
+   * principal variation from the search
+   */
+  struct RootMove {
+    Move move;
+    int  score;         // score in the current iteration (-INF if not raised alpha)
+    int  prevScore;     // score in the previous iteration
+    U64  nodes;         // nodes spent on the move in the current iteration
+    U64  totalNodes;    // nodes spent on the move in the whole search
+    pV   pv;
+    int  tbRank;        // rank by endgame tablebases, higher is better
+    int  tbScore;       // score by endgame tablebases
+
+    RootMove (Move m) : move(m), score(-INF), prevScore(-INF), nodes(0), totalNodes(0), pv(), tbRank(0), tbScore(0) {};
+  };
+
 
 #endif
\ No newline at end of file
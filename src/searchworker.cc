@@ -0,0 +1,38 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "searchworker.h"
+
+SearchWorker::SearchWorker(int threadId, int hashSize) : _threadId(threadId), _ordering(new OrderingInfo()) {
+  _hash.HASH_Initalize_MB(hashSize);
+}
+
+void SearchWorker::clear(){
+  _hash.HASH_Clear();
+  _ordering->clearAllHistory();
+}
+
+Search & SearchWorker::setPosition(const Board &board, const Limits &limits, const Hist &history){
+  if (!_search){
+    _search.reset(new Search(board, limits, history, _ordering.get(), false, _threadId));
+    _search->setHashTable(&_hash);
+    _search->setStandalone();
+  }else{
+    _search->setPosition(board, limits, history);
+  }
+  return *_search;
+}
@@ -0,0 +1,66 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef SEARCHWORKER_H
+#define SEARCHWORKER_H
+
+#include "search.h"
+#include "transptable.h"
+#include "orderinginfo.h"
+#include <memory>
+
+/**
+ * @brief Standalone search of a thread of the command line modes
+ * (deterministic bench, analyze, testsuite, datagen).
+ *
+ * Worker owns its TT, move ordering info and Search object, so its
+ * searches do not depend on other threads and on the UCI search.
+ * TT is freed together with the worker.
+ */
+class SearchWorker {
+ public:
+  /**
+   * @brief Constructs a new SearchWorker
+   *
+   * @param threadId Index of the thread, selects node counter of the search
+   * @param hashSize TT size in MB
+   */
+  SearchWorker(int, int);
+
+  /**
+   * @brief Clears TT and move ordering history before a new position or game
+   */
+  void clear();
+
+  /**
+   * @brief Prepares the search of the given position (see Search::setPosition)
+   *
+   * @param board The board to search
+   * @param limits limits imposed on this search
+   * @param positionHistory ZKeys of the positions that have occurred in the game
+   * @return Search to run
+   */
+  Search & setPosition(const Board &, const Limits &, const Hist &);
+
+ private:
+  int _threadId;
+  HASH _hash;
+  std::unique_ptr<OrderingInfo> _ordering;
+  std::unique_ptr<Search> _search;
+};
+
+#endif
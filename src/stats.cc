@@ -0,0 +1,87 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "stats.h"
+#include <cstdio>
+
+namespace {
+
+SEARCH_Stats cStats[MAX_THREADS];
+SEARCH_Stats lastStats;
+
+#ifdef _STATS_
+// counters of threads that are not searching go here
+SEARCH_Stats spareStats;
+
+std::string percent(U64 part, U64 total){
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.1f%%", total ? 100.0 * part / total : 0.0);
+  return buf;
+}
+
+std::string line(const std::string &name, U64 part, U64 total, const std::string &partName, const std::string &totalName){
+  return "info string stats " + name + " " + totalName + " " + std::to_string(total) + " "
+         + partName + " " + std::to_string(part) + " (" + percent(part, total) + ")\n";
+}
+#endif
+
+}
+
+#ifdef _STATS_
+thread_local SEARCH_Stats * tStats = &spareStats;
+#endif
+
+void Stats::attach(int threadId){
+#ifdef _STATS_
+  tStats = &cStats[threadId];
+  tStats->Reset();
+#else
+  (void) threadId;
+#endif
+}
+
+void Stats::collect(int threads, U64 ttProbes, U64 ttHits){
+  lastStats.Reset();
+  for (int i = 0; i < threads; i++){
+    for (int j = 0; j < ST_COUNT; j++){
+      lastStats.counters[j] += cStats[i].counters[j];
+    }
+  }
+  lastStats.counters[ST_TT_PROBE] = ttProbes;
+  lastStats.counters[ST_TT_HIT]   = ttHits;
+}
+
+std::string Stats::report(){
+#ifndef _STATS_
+  return "info string stats are not compiled in, build with STATS=1\n";
+#else
+  const U64 * c = lastStats.counters;
+  std::string s;
+
+  s += line("nodes", c[ST_QNODES], c[ST_NODES] + c[ST_QNODES], "qsearch", "total");
+  s += line("tt", c[ST_TT_HIT], c[ST_TT_PROBE], "hits", "probes");
+  s += line("tt", c[ST_TT_CUTOFF], c[ST_TT_HIT], "cutoffs", "hits");
+  s += line("nmp", c[ST_NMP_CUT], c[ST_NMP_TRY], "cutoffs", "tries");
+  s += line("lmr", c[ST_LMR_RESEARCH], c[ST_LMR_SEARCH], "researches", "searches");
+  s += line("probcut", c[ST_PROBCUT_CUT], c[ST_PROBCUT_TRY], "cutoffs", "tries");
+  s += line("singular", c[ST_SINGULAR_EXT], c[ST_SINGULAR_TRY], "extensions", "searches");
+  s += line("singular", c[ST_SINGEVAL_EXT], c[ST_SINGEVAL_TRY], "extensions", "evals");
+  s += line("nnue", c[ST_NN_RESET], c[ST_NN_INCREMENTAL] + c[ST_NN_RESET], "resets", "updates");
+  s += line("finny", c[ST_FINNY_DIFF], c[ST_FINNY_DIFF] + c[ST_FINNY_REFRESH], "diffs", "resets");
+  return s;
+#endif
+}
@@ -0,0 +1,104 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef STATS_H
+#define STATS_H
+
+#include "defs.h"
+#include <string>
+
+/**
+ * @brief Search statistics counters.
+ *
+ * Counters are compiled in only with _STATS_ defined (make STATS=1),
+ * otherwise STATS_ADD() expands to nothing.
+ */
+enum StatCounter {
+  ST_NODES,           /**< nodes of the main search */
+  ST_QNODES,          /**< nodes of the quiescence search */
+  ST_TT_PROBE,        /**< transposition table probes (taken from THREAD_Counter) */
+  ST_TT_HIT,          /**< transposition table hits (taken from THREAD_Counter) */
+  ST_TT_CUTOFF,       /**< cutoffs by transposition table score */
+  ST_NMP_TRY,         /**< null move searches */
+  ST_NMP_CUT,         /**< null move searches that failed high */
+  ST_LMR_SEARCH,      /**< reduced searches */
+  ST_LMR_RESEARCH,    /**< reduced searches that had to be re-searched */
+  ST_PROBCUT_TRY,     /**< probcut reduced searches */
+  ST_PROBCUT_CUT,     /**< probcut cutoffs */
+  ST_SINGULAR_TRY,    /**< singular verification searches */
+  ST_SINGULAR_EXT,    /**< singular extensions after a verification search */
+  ST_SINGEVAL_TRY,    /**< singular checks by static eval at low depth (no search) */
+  ST_SINGEVAL_EXT,    /**< singular extensions after a static eval check */
+  ST_NN_INCREMENTAL,  /**< incremental accumulator updates */
+  ST_NN_RESET,        /**< accumulator updates that required a reset (king bucket change) */
+  ST_FINNY_DIFF,      /**< resets done from Finny table by board difference */
+  ST_FINNY_REFRESH,   /**< resets done by half refresh of the accumulator */
+  ST_COUNT
+};
+
+/**
+ * @brief Per-thread statistics, written only by its owner thread
+ */
+struct alignas(64) SEARCH_Stats
+{
+  U64 counters[ST_COUNT];
+
+  SEARCH_Stats() : counters{0} {};
+
+  void Reset(){
+    for (int i = 0; i < ST_COUNT; i++) counters[i] = 0;
+  }
+};
+
+#ifdef _STATS_
+extern thread_local SEARCH_Stats * tStats;
+#define STATS_ADD(counter) (tStats->counters[(counter)]++)
+#else
+#define STATS_ADD(counter)
+#endif
+
+namespace Stats {
+
+/**
+ * @brief Attaches calling thread to statistics of the given search thread
+ * and resets them
+ *
+ * @param threadId index of the search thread
+ */
+void attach(int);
+
+/**
+ * @brief Merges statistics of the given number of threads into the
+ * statistics of the last search
+ *
+ * TT probes are always counted by the node counters of the threads
+ * (THREAD_Counter), their totals are passed here.
+ *
+ * @param threads number of search threads
+ * @param ttProbes TT probes of all threads
+ * @param ttHits TT hits of all threads
+ */
+void collect(int, U64, U64);
+
+/**
+ * @brief Returns statistics of the last search as UCI "info string" lines
+ */
+std::string report();
+
+}
+
+#endif
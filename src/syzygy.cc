@@ -0,0 +1,1128 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syzygy.h"
+#include "movegen.h"
+#include "attacks.h"
+#include "bitutils.h"
+#include "zkey.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Syzygy tables decoding.
+// Format and encoding are described in the comments of the
+// original probing code by Ronald de Man and its Stockfish rewrite,
+// this is an adaptation of the latter to the engine board.
+
+namespace {
+
+const int TB_PIECES = 7;
+
+enum TBType { WDL, DTZ };
+
+// Flags of the PairsData
+enum TBFlag { STM = 1, MAPPED = 2, WIN_PLIES = 4, LOSS_PLIES = 8, WIDE = 16, SINGLE_VALUE = 128 };
+
+// Tables use piece codes: white 1..6 (P, N, B, R, Q, K), black 9..14
+const int  TB_TYPE[6] = {1, 4, 2, 3, 5, 6};  // indexed by PieceType
+const char TB_CHAR[]  = " PNBRQK";
+
+#ifdef _WIN32
+const char PATH_SEPARATOR = ';';
+#else
+const char PATH_SEPARATOR = ':';
+#endif
+
+// Numbers in table files are stored in either byte order
+template <typename T, bool LittleEndian>
+T number(const void * addr) {
+  const uint8_t * p = (const uint8_t *) addr;
+  T value = 0;
+  for (size_t i = 0; i < sizeof(T); i++) {
+    value |= (T) p[LittleEndian ? i : sizeof(T) - 1 - i] << (8 * i);
+  }
+  return value;
+}
+
+// Entry of the sparse index into blockLength[], little endian
+struct SparseEntry {
+  uint8_t block[4];   // Number of the block
+  uint8_t offset[2];  // Offset within the block
+};
+
+typedef uint16_t Sym;  // Huffman symbol
+
+// Pair of symbols a symbol expands into: 12 bits each
+struct LR {
+  uint8_t lr[3];
+
+  Sym left()  const { return ((lr[1] & 0xF) << 8) | lr[0]; }
+  Sym right() const { return (lr[2] << 4) | (lr[1] >> 4); }
+};
+
+// Compression data of one table (side to move and leading pawn file)
+struct PairsData {
+  int flags;
+  size_t sizeofBlock;             // Block size in bytes
+  size_t span;                    // About every span values there is a sparse index entry
+  int numBlocks;                  // Number of blocks in the file
+  int maxSymLen;                  // Maximum length in bits of the Huffman symbols
+  int minSymLen;                  // Minimum length in bits of the Huffman symbols
+  const Sym * lowestSym;          // lowestSym[l] is the symbol of length l with the lowest value
+  const LR * btree;               // btree[sym] stores the left and right symbols that expand sym
+  const uint16_t * blockLength;   // Number of stored positions (minus one) of each block
+  int blockLengthSize;            // Size of blockLength[], padded to be bigger than numBlocks
+  const SparseEntry * sparseIndex;
+  size_t sparseIndexSize;
+  const uint8_t * data;           // Start of Huffman compressed data
+  std::vector<U64> base64;        // base64[l - minSymLen] is the 64 bit padded lowest symbol of length l
+  std::vector<uint8_t> symlen;    // Number of values (minus one) represented by a symbol
+  int pieces[TB_PIECES];          // Piece order, it defines the groups
+  U64 groupIdx[TB_PIECES + 1];    // Start index of the encoding of the group
+  int groupLen[TB_PIECES + 1];    // Number of pieces in the group: KRKN -> (3, 1)
+  uint16_t mapIdx[4];             // Score maps of DTZ: win, loss, cursed win, blessed loss
+
+  PairsData() : flags(0), sizeofBlock(0), span(0), numBlocks(0), maxSymLen(0), minSymLen(0),
+                lowestSym(nullptr), btree(nullptr), blockLength(nullptr), blockLengthSize(0),
+                sparseIndex(nullptr), sparseIndexSize(0), data(nullptr),
+                pieces{}, groupIdx{}, groupLen{}, mapIdx{} {};
+};
+
+// Table of one material, WDL or DTZ
+struct TBTable {
+  TBType type;
+  std::string name;       // like KQvKR, strong side first
+  std::string dir;        // directory of the files
+  std::atomic<bool> ready;
+  void * baseAddress;
+  size_t mapping;
+  const uint8_t * map;    // DTZ score maps
+  U64 key;                // material key with strong side white
+  U64 key2;               // material key with strong side black
+  int pieceCount;
+  bool hasPawns;
+  bool hasUniquePieces;
+  int pawnCount[2];       // leading color / other color
+  PairsData items[2][4];  // [side to move][leading pawn file]
+
+  TBTable(TBType t, const std::string &n, const std::string &d)
+      : type(t), name(n), dir(d), ready(false), baseAddress(nullptr), mapping(0), map(nullptr),
+        key(0), key2(0), pieceCount(0), hasPawns(false), hasUniquePieces(false), pawnCount{} {};
+
+  PairsData * get(int stm, int f) {
+    return &items[type == WDL ? stm % 2 : 0][hasPawns ? f : 0];
+  }
+};
+
+std::deque<TBTable> tables;
+std::unordered_map<U64, std::pair<TBTable *, TBTable *>> tableByKey;  // WDL, DTZ
+int maxCardinality = 0;
+
+// Encoding tables
+int mapPawns[64];
+int mapB1H1H7[64];
+int mapA1D1D4[64];
+int mapKK[10][64];
+U64 binomial[6][64];
+U64 leadPawnIdx[6][64];
+U64 leadPawnsSize[6][4];
+
+inline int rankOf(int sq)   { return sq >> 3; }
+inline int fileOf(int sq)   { return sq & 7; }
+inline int offA1H8(int sq)  { return rankOf(sq) - fileOf(sq); }
+inline int flipFile(int sq) { return sq ^ 7; }
+inline int flipRank(int sq) { return sq ^ 56; }
+
+bool pawnsComp(int i, int j) { return mapPawns[i] < mapPawns[j]; }
+
+template <typename T> int signOf(T val) {
+  return (T(0) < val) - (val < T(0));
+}
+
+// DTZ of the move that zeroes the 50-move counter, by WDL of the position before it
+int dtzBeforeZeroing(int wdl) {
+  return wdl == Syzygy::WDL_WIN          ?  1   :
+         wdl == Syzygy::WDL_CURSED_WIN   ?  101 :
+         wdl == Syzygy::WDL_BLESSED_LOSS ? -101 :
+         wdl == Syzygy::WDL_LOSS         ? -1   : 0;
+}
+
+U64 materialKey(const std::string &white, const std::string &black) {
+  std::string pseudoFen = white;
+  for (char c : black) pseudoFen += (char) tolower(c);
+
+  ZKey key;
+  key.setpKeyFromString(pseudoFen);
+  return key.getValue();
+}
+
+int pieceOn(const Board &board, int sq) {
+  Color color = (board.getAllPieces(WHITE) & (ONE << sq)) ? WHITE : BLACK;
+  return (color == BLACK ? 8 : 0) + TB_TYPE[board.getPieceAtSquare(color, sq)];
+}
+
+bool isZeroing(const Move &move) {
+  return (move.getFlags() & (Move::CAPTURE | Move::EN_PASSANT)) || move.getPieceType() == PAWN;
+}
+
+bool isCapture(const Move &move) {
+  return move.getFlags() & (Move::CAPTURE | Move::EN_PASSANT);
+}
+
+bool hasLegalMove(const Board &board) {
+  MoveList moves;
+  MoveGen(&board, false, &moves);
+  for (auto &move : moves) {
+    Board child = board;
+    if (child.doMove(move)) return true;
+  }
+  return false;
+}
+
+bool isMate(const Board &board) {
+  return board.colorIsInCheck(board.getActivePlayer()) && !hasLegalMove(board);
+}
+
+// Table file mapping
+
+const uint8_t * mapFile(TBTable &e) {
+  std::string fname = e.dir + "/" + e.name + (e.type == WDL ? ".rtbw" : ".rtbz");
+
+  int fd = open(fname.c_str(), O_RDONLY);
+  if (fd == -1) return nullptr;
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) == -1 || fileStat.st_size % 64 != 16) {
+    std::cerr << "Corrupt tablebase file " << fname << std::endl;
+    close(fd);
+    return nullptr;
+  }
+
+  void * data = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    std::cerr << "Failed to map tablebase file " << fname << std::endl;
+    return nullptr;
+  }
+  madvise(data, fileStat.st_size, MADV_RANDOM);
+
+  const uint8_t MAGIC[2][4] = {{0xD7, 0x66, 0x0C, 0xA5}, {0x71, 0xE8, 0x23, 0x5D}};
+  if (memcmp(data, MAGIC[e.type == WDL], 4)) {
+    std::cerr << "Corrupt tablebase file " << fname << std::endl;
+    munmap(data, fileStat.st_size);
+    return nullptr;
+  }
+
+  e.baseAddress = data;
+  e.mapping = fileStat.st_size;
+  return (const uint8_t *) data + 4;
+}
+
+// Table header parsing
+
+// Sets groups of pieces and their start indices:
+// encoding is g1 * N(g2) * N(g3) + g2 * N(g3) + g3, order of
+// the groups is stored in the file
+void setGroups(TBTable &e, PairsData * d, int order[], int f) {
+  int n = 0, firstLen = e.hasPawns ? 0 : e.hasUniquePieces ? 3 : 2;
+  d->groupLen[n] = 1;
+
+  for (int i = 1; i < e.pieceCount; i++) {
+    if (--firstLen > 0 || d->pieces[i] == d->pieces[i - 1]) {
+      d->groupLen[n]++;
+    } else {
+      d->groupLen[++n] = 1;
+    }
+  }
+  d->groupLen[++n] = 0;
+
+  bool pp = e.hasPawns && e.pawnCount[1];  // pawns on both sides
+  int next = pp ? 2 : 1;
+  int freeSquares = 64 - d->groupLen[0] - (pp ? d->groupLen[1] : 0);
+  U64 idx = 1;
+
+  for (int k = 0; next < n || k == order[0] || k == order[1]; k++) {
+    if (k == order[0]) {
+      // Leading pawns or pieces
+      d->groupIdx[0] = idx;
+      idx *= e.hasPawns ? leadPawnsSize[d->groupLen[0]][f]
+           : e.hasUniquePieces ? 31332 : 462;
+    } else if (k == order[1]) {
+      // Remaining pawns
+      d->groupIdx[1] = idx;
+      idx *= binomial[d->groupLen[1]][48 - d->groupLen[0]];
+    } else {
+      // Remaining pieces
+      d->groupIdx[next] = idx;
+      idx *= binomial[d->groupLen[next]][freeSquares];
+      freeSquares -= d->groupLen[next++];
+    }
+  }
+
+  d->groupIdx[n] = idx;
+}
+
+uint8_t setSymlen(PairsData * d, Sym s, std::vector<bool> &visited) {
+  visited[s] = true;
+  Sym sr = d->btree[s].right();
+
+  if (sr == 0xFFF) return 0;
+
+  Sym sl = d->btree[s].left();
+
+  if (!visited[sl]) d->symlen[sl] = setSymlen(d, sl, visited);
+  if (!visited[sr]) d->symlen[sr] = setSymlen(d, sr, visited);
+
+  return d->symlen[sl] + d->symlen[sr] + 1;
+}
+
+const uint8_t * setSizes(PairsData * d, const uint8_t * data) {
+  d->flags = *data++;
+
+  if (d->flags & SINGLE_VALUE) {
+    d->numBlocks = d->blockLengthSize = 0;
+    d->span = d->sparseIndexSize = 0;
+    d->minSymLen = *data++;  // the single value
+    return data;
+  }
+
+  // Last groupIdx[] is the size of the table
+  U64 tbSize = d->groupIdx[std::find(d->groupLen, d->groupLen + TB_PIECES, 0) - d->groupLen];
+
+  d->sizeofBlock = 1ULL << *data++;
+  d->span = 1ULL << *data++;
+  d->sparseIndexSize = (tbSize + d->span - 1) / d->span;
+  int padding = *data++;
+  d->numBlocks = number<uint32_t, true>(data); data += 4;
+  d->blockLengthSize = d->numBlocks + padding;
+  d->maxSymLen = *data++;
+  d->minSymLen = *data++;
+  d->lowestSym = (const Sym *) data;
+  d->base64.resize(d->maxSymLen - d->minSymLen + 1);
+
+  // Canonical Huffman code: longer symbols have lower values,
+  // base64[l] is the lowest symbol of length l padded to 64 bits
+  for (int i = (int) d->base64.size() - 2; i >= 0; i--) {
+    d->base64[i] = (d->base64[i + 1] + number<Sym, true>(&d->lowestSym[i])
+                                     - number<Sym, true>(&d->lowestSym[i + 1])) / 2;
+  }
+  for (size_t i = 0; i < d->base64.size(); i++) {
+    d->base64[i] <<= 64 - i - d->minSymLen;
+  }
+
+  data += d->base64.size() * sizeof(Sym);
+  d->symlen.resize(number<uint16_t, true>(data)); data += 2;
+  d->btree = (const LR *) data;
+
+  // Symbols are built by recursive pairing, symlen is the number of
+  // values a symbol expands to
+  std::vector<bool> visited(d->symlen.size());
+  for (Sym sym = 0; sym < d->symlen.size(); sym++) {
+    if (!visited[sym]) d->symlen[sym] = setSymlen(d, sym, visited);
+  }
+
+  return data + d->symlen.size() * sizeof(LR) + (d->symlen.size() & 1);
+}
+
+const uint8_t * setDtzMap(TBTable &e, const uint8_t * data, int maxFile) {
+  if (e.type == WDL) return data;
+
+  e.map = data;
+
+  for (int f = 0; f <= maxFile; f++) {
+    PairsData * d = e.get(0, f);
+    if (d->flags & MAPPED) {
+      if (d->flags & WIDE) {
+        data += (uintptr_t) data & 1;  // word alignment
+        for (int i = 0; i < 4; i++) {
+          d->mapIdx[i] = (uint16_t) ((data - e.map) / 2 + 1);
+          data += 2 * number<uint16_t, true>(data) + 2;
+        }
+      } else {
+        for (int i = 0; i < 4; i++) {
+          d->mapIdx[i] = (uint16_t) (data - e.map + 1);
+          data += *data + 1;
+        }
+      }
+    }
+  }
+
+  return data + ((uintptr_t) data & 1);
+}
+
+void setTable(TBTable &e, const uint8_t * data) {
+  data++;  // flags: split, has pawns
+
+  const int sides = e.type == WDL && e.key != e.key2 ? 2 : 1;
+  const int maxFile = e.hasPawns ? 3 : 0;
+
+  bool pp = e.hasPawns && e.pawnCount[1];
+
+  for (int f = 0; f <= maxFile; f++) {
+    for (int i = 0; i < sides; i++) {
+      *e.get(i, f) = PairsData();
+    }
+
+    int order[2][2] = {{*data & 0xF, pp ? *(data + 1) & 0xF : 0xF},
+                       {*data >> 4,  pp ? *(data + 1) >> 4  : 0xF}};
+    data += 1 + pp;
+
+    for (int k = 0; k < e.pieceCount; k++, data++) {
+      for (int i = 0; i < sides; i++) {
+        e.get(i, f)->pieces[k] = i ? *data >> 4 : *data & 0xF;
+      }
+    }
+
+    for (int i = 0; i < sides; i++) {
+      setGroups(e, e.get(i, f), order[i], f);
+    }
+  }
+
+  data += (uintptr_t) data & 1;
+
+  for (int f = 0; f <= maxFile; f++) {
+    for (int i = 0; i < sides; i++) {
+      data = setSizes(e.get(i, f), data);
+    }
+  }
+
+  data = setDtzMap(e, data, maxFile);
+
+  for (int f = 0; f <= maxFile; f++) {
+    for (int i = 0; i < sides; i++) {
+      PairsData * d = e.get(i, f);
+      d->sparseIndex = (const SparseEntry *) data;
+      data += d->sparseIndexSize * sizeof(SparseEntry);
+    }
+  }
+
+  for (int f = 0; f <= maxFile; f++) {
+    for (int i = 0; i < sides; i++) {
+      PairsData * d = e.get(i, f);
+      d->blockLength = (const uint16_t *) data;
+      data += d->blockLengthSize * sizeof(uint16_t);
+    }
+  }
+
+  for (int f = 0; f <= maxFile; f++) {
+    for (int i = 0; i < sides; i++) {
+      data = (const uint8_t *) (((uintptr_t) data + 0x3F) & ~(uintptr_t) 0x3F);  // 64 byte alignment
+      PairsData * d = e.get(i, f);
+      d->data = data;
+      data += (size_t) d->numBlocks * d->sizeofBlock;
+    }
+  }
+}
+
+// Maps the table file on the first use,
+// returns false if table is not available
+bool mapped(TBTable &e) {
+  static std::mutex mutex;
+
+  if (e.ready.load(std::memory_order_acquire)) return e.baseAddress != nullptr;
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (e.ready.load(std::memory_order_relaxed)) return e.baseAddress != nullptr;
+
+  const uint8_t * data = mapFile(e);
+  if (data) setTable(e, data);
+
+  e.ready.store(true, std::memory_order_release);
+  return e.baseAddress != nullptr;
+}
+
+// Table probing
+
+// Value stored at the given index of the table:
+// find the block by the sparse index, then decode Huffman symbols
+// of the block and expand the one containing the index
+int decompressPairs(PairsData * d, U64 idx) {
+  if (d->flags & SINGLE_VALUE) return d->minSymLen;
+
+  U64 k = idx / d->span;
+
+  uint32_t block = number<uint32_t, true>(d->sparseIndex[k].block);
+  int offset     = number<uint16_t, true>(d->sparseIndex[k].offset);
+
+  // Sparse entry points to the middle of its span
+  offset += (int) (idx % d->span) - (int) (d->span / 2);
+
+  while (offset < 0) {
+    offset += number<uint16_t, true>(&d->blockLength[--block]) + 1;
+  }
+  while (offset > number<uint16_t, true>(&d->blockLength[block])) {
+    offset -= number<uint16_t, true>(&d->blockLength[block++]) + 1;
+  }
+
+  const uint8_t * ptr = d->data + (U64) block * d->sizeofBlock;
+
+  U64 buf64 = number<U64, false>(ptr); ptr += 8;
+  int buf64Size = 64;
+  Sym sym;
+
+  while (true) {
+    int len = 0;  // symbol length - minSymLen
+
+    while (buf64 < d->base64[len]) len++;
+
+    sym = (Sym) ((buf64 - d->base64[len]) >> (64 - len - d->minSymLen));
+    sym += number<Sym, true>(&d->lowestSym[len]);
+
+    if (offset < d->symlen[sym] + 1) break;
+
+    offset -= d->symlen[sym] + 1;
+    len += d->minSymLen;
+    buf64 <<= len;
+    buf64Size -= len;
+
+    if (buf64Size <= 32) {
+      buf64Size += 32;
+      buf64 |= (U64) number<uint32_t, false>(ptr) << (64 - buf64Size);
+      ptr += 4;
+    }
+  }
+
+  // Symbols of the pair are adjacent, so go down the tree
+  // to the leaf holding the value
+  while (d->symlen[sym]) {
+    Sym left = d->btree[sym].left();
+
+    if (offset < d->symlen[left] + 1) {
+      sym = left;
+    } else {
+      offset -= d->symlen[left] + 1;
+      sym = d->btree[sym].right();
+    }
+  }
+
+  return d->btree[sym].left();
+}
+
+// DTZ tables store one side to move only
+bool checkDtzStm(TBTable &e, int stm, int f) {
+  if (e.type == WDL) return true;
+
+  int flags = e.get(stm, f)->flags;
+  return (flags & STM) == stm || (e.key == e.key2 && !e.hasPawns);
+}
+
+// Converts stored value to WDL or DTZ in plies
+int mapScore(TBTable &e, int f, int value, int wdl) {
+  if (e.type == WDL) return value - 2;
+
+  const int WDL_MAP[] = {1, 3, 0, 2, 0};
+
+  PairsData * d = e.get(0, f);
+
+  if (d->flags & MAPPED) {
+    if (d->flags & WIDE) {
+      value = number<uint16_t, true>(e.map + 2 * (d->mapIdx[WDL_MAP[wdl + 2]] + value));
+    } else {
+      value = e.map[d->mapIdx[WDL_MAP[wdl + 2]] + value];
+    }
+  }
+
+  // DTZ can be stored in moves, return plies
+  if ((wdl == Syzygy::WDL_WIN  && !(d->flags & WIN_PLIES))
+   || (wdl == Syzygy::WDL_LOSS && !(d->flags & LOSS_PLIES))
+   ||  wdl == Syzygy::WDL_CURSED_WIN
+   ||  wdl == Syzygy::WDL_BLESSED_LOSS) {
+    value *= 2;
+  }
+
+  return value + 1;
+}
+
+int doProbeTable(const Board &board, TBTable &e, int wdl, Syzygy::ProbeState * result) {
+  int squares[TB_PIECES];
+  int pieces[TB_PIECES];
+  U64 idx;
+  int next = 0, size = 0, leadPawnsCnt = 0;
+  U64 b, leadPawns = 0;
+  int tbFile = 0;
+  int stmColor = board.getActivePlayer() == WHITE ? 0 : 1;
+
+  // Tables are built with strong side white. If black is the strong side,
+  // or material is symmetric and black is to move, colors and squares are flipped
+  bool symmetricBlackToMove = (e.key == e.key2 && stmColor);
+  bool blackStronger = (board.getpCountKey().getValue() != e.key);
+
+  int flipColor   = (symmetricBlackToMove || blackStronger) * 8;
+  int flipSquares = (symmetricBlackToMove || blackStronger) * 56;
+  int stm         = (symmetricBlackToMove || blackStronger) ^ stmColor;
+
+  // Tables with pawns are split by the file of the leading pawn:
+  // the one closest to the edge, lowest rank first
+  if (e.hasPawns) {
+    int pc = e.get(0, 0)->pieces[0] ^ flipColor;
+
+    leadPawns = b = board.getPieces((pc >> 3) ? BLACK : WHITE, PAWN);
+    while (b) {
+      squares[size++] = _popLsb(b) ^ flipSquares;
+    }
+
+    leadPawnsCnt = size;
+
+    std::swap(squares[0], *std::max_element(squares, squares + leadPawnsCnt, pawnsComp));
+
+    tbFile = std::min(fileOf(squares[0]), 7 - fileOf(squares[0]));
+  }
+
+  if (!checkDtzStm(e, stm, tbFile)) {
+    *result = Syzygy::CHANGE_STM;
+    return 0;
+  }
+
+  b = board.getOccupied() ^ leadPawns;
+  while (b) {
+    int sq = _popLsb(b);
+    squares[size] = sq ^ flipSquares;
+    pieces[size++] = pieceOn(board, sq) ^ flipColor;
+  }
+
+  PairsData * d = e.get(stm, tbFile);
+
+  // Reorder pieces to the sequence of the table
+  for (int i = leadPawnsCnt; i < size - 1; i++) {
+    for (int j = i + 1; j < size; j++) {
+      if (d->pieces[i] == pieces[j]) {
+        std::swap(pieces[i], pieces[j]);
+        std::swap(squares[i], squares[j]);
+        break;
+      }
+    }
+  }
+
+  // Leading piece goes to the a1-d1-d4 triangle (files a-d for pawns)
+  if (fileOf(squares[0]) > 3) {
+    for (int i = 0; i < size; i++) squares[i] = flipFile(squares[i]);
+  }
+
+  if (e.hasPawns) {
+    idx = leadPawnIdx[leadPawnsCnt][squares[0]];
+
+    std::stable_sort(squares + 1, squares + leadPawnsCnt, pawnsComp);
+
+    for (int i = 1; i < leadPawnsCnt; i++) {
+      idx += binomial[i][mapPawns[squares[i]]];
+    }
+  } else {
+    if (rankOf(squares[0]) > 3) {
+      for (int i = 0; i < size; i++) squares[i] = flipRank(squares[i]);
+    }
+
+    // First piece of the leading group not on a1-h8 diagonal
+    // should be below it
+    for (int i = 0; i < d->groupLen[0]; i++) {
+      if (!offA1H8(squares[i])) continue;
+
+      if (offA1H8(squares[i]) > 0) {
+        for (int j = i; j < size; j++) {
+          squares[j] = ((squares[j] >> 3) | (squares[j] << 3)) & 63;
+        }
+      }
+      break;
+    }
+
+    if (e.hasUniquePieces) {
+      // Three unique pieces (kings included) are encoded together
+      int adjust1 =  (squares[1] > squares[0]);
+      int adjust2 =  (squares[2] > squares[0]) + (squares[2] > squares[1]);
+
+      if (offA1H8(squares[0])) {
+        idx = ((U64) mapA1D1D4[squares[0]] * 63 + (squares[1] - adjust1)) * 62 + squares[2] - adjust2;
+      } else if (offA1H8(squares[1])) {
+        idx = (6 * 63 + rankOf(squares[0]) * 28 + mapB1H1H7[squares[1]]) * 62 + squares[2] - adjust2;
+      } else if (offA1H8(squares[2])) {
+        idx = 6 * 63 * 62 + 4 * 28 * 62
+            + rankOf(squares[0]) * 7 * 28
+            + (rankOf(squares[1]) - adjust1) * 28
+            + mapB1H1H7[squares[2]];
+      } else {
+        idx = 6 * 63 * 62 + 4 * 28 * 62 + 4 * 7 * 28
+            + rankOf(squares[0]) * 7 * 6
+            + (rankOf(squares[1]) - adjust1) * 6
+            + (rankOf(squares[2]) - adjust2);
+      }
+    } else {
+      // Only kings are unique
+      idx = mapKK[mapA1D1D4[squares[0]]][squares[1]];
+    }
+  }
+
+  idx *= d->groupIdx[0];
+  int * groupSq = squares + d->groupLen[0];
+
+  // Remaining pawns, then pieces, in ascending order of squares
+  bool remainingPawns = e.hasPawns && e.pawnCount[1];
+
+  while (d->groupLen[++next]) {
+    std::stable_sort(groupSq, groupSq + d->groupLen[next]);
+    U64 n = 0;
+
+    // Skip squares taken by previous groups
+    for (int i = 0; i < d->groupLen[next]; i++) {
+      int adjust = 0;
+      for (int * s = squares; s < groupSq; s++) adjust += groupSq[i] > *s;
+      n += binomial[i + 1][groupSq[i] - adjust - 8 * remainingPawns];
+    }
+
+    remainingPawns = false;
+    idx += n * d->groupIdx[next];
+    groupSq += d->groupLen[next];
+  }
+
+  return mapScore(e, tbFile, decompressPairs(d, idx), wdl);
+}
+
+int probeTable(const Board &board, TBType type, Syzygy::ProbeState * result, int wdl = Syzygy::WDL_DRAW) {
+  if (_popCount(board.getOccupied()) == 2) return Syzygy::WDL_DRAW;  // KvK
+
+  auto entry = tableByKey.find(board.getpCountKey().getValue());
+  if (entry == tableByKey.end()) {
+    *result = Syzygy::FAIL;
+    return 0;
+  }
+
+  TBTable &e = type == WDL ? *entry->second.first : *entry->second.second;
+  if (!mapped(e)) {
+    *result = Syzygy::FAIL;
+    return 0;
+  }
+
+  return doProbeTable(board, e, wdl, result);
+}
+
+// WDL of the position, resolving captures (and pawn moves if checkZeroing)
+// by a search, because tables may hold a "don't care" value when the best
+// move is a capture and do not know en passant
+int search(const Board &board, Syzygy::ProbeState * result, bool checkZeroing) {
+  int value, bestValue = Syzygy::WDL_LOSS;
+
+  MoveList moves;
+  MoveGen(&board, false, &moves);
+  size_t moveCount = 0;
+
+  for (auto &move : moves) {
+    if (!isCapture(move) && (!checkZeroing || move.getPieceType() != PAWN)) continue;
+
+    Board child = board;
+    if (!child.doMove(move)) continue;
+
+    moveCount++;
+
+    value = -search(child, result, false);
+
+    if (*result == Syzygy::FAIL) return Syzygy::WDL_DRAW;
+
+    if (value > bestValue) {
+      bestValue = value;
+
+      if (value >= Syzygy::WDL_WIN) {
+        *result = Syzygy::ZEROING_BEST_MOVE;
+        return value;
+      }
+    }
+  }
+
+  // If all legal moves were searched, table is not needed:
+  // stop at the first legal move that was not searched
+  bool noMoreMoves = moveCount != 0;
+  for (auto &move : moves) {
+    if (!noMoreMoves) break;
+    if (isCapture(move) || (checkZeroing && move.getPieceType() == PAWN)) continue;
+
+    Board child = board;
+    if (child.doMove(move)) noMoreMoves = false;
+  }
+
+  if (noMoreMoves) {
+    value = bestValue;
+  } else {
+    value = probeTable(board, WDL, result);
+    if (*result == Syzygy::FAIL) return Syzygy::WDL_DRAW;
+  }
+
+  if (bestValue >= value) {
+    *result = (bestValue > Syzygy::WDL_DRAW || noMoreMoves) ? Syzygy::ZEROING_BEST_MOVE : Syzygy::OK;
+    return bestValue;
+  }
+
+  *result = Syzygy::OK;
+  return value;
+}
+
+// Table initialization
+
+void initEncoding() {
+  // mapB1H1H7[] encodes a square below a1-h8 diagonal to 0..27
+  int code = 0;
+  for (int s = 0; s < 64; s++) {
+    if (offA1H8(s) < 0) mapB1H1H7[s] = code++;
+  }
+
+  // mapA1D1D4[] encodes a square in the a1-d1-d4 triangle to 0..9,
+  // diagonal squares go last
+  std::vector<int> diagonal;
+  code = 0;
+  for (int s : {a1, b1, c1, d1, a2, b2, c2, d2, a3, b3, c3, d3, a4, b4, c4, d4}) {
+    if (offA1H8(s) < 0) {
+      mapA1D1D4[s] = code++;
+    } else if (!offA1H8(s)) {
+      diagonal.push_back(s);
+    }
+  }
+  for (int s : diagonal) {
+    mapA1D1D4[s] = code++;
+  }
+
+  // mapKK[] encodes 462 legal positions of two kings, first one in the
+  // a1-d1-d4 triangle. If it is on the diagonal, second one is not above it
+  std::vector<std::pair<int, int>> bothOnDiagonal;
+  code = 0;
+  for (int idx = 0; idx < 10; idx++) {
+    for (int s1 = a1; s1 <= d4; s1++) {
+      if (mapA1D1D4[s1] == idx && (idx || s1 == b1)) {
+        for (int s2 = 0; s2 < 64; s2++) {
+          if ((Attacks::getNonSlidingAttacks(KING, s1) | (ONE << s1)) & (ONE << s2)) {
+            continue;
+          } else if (!offA1H8(s1) && offA1H8(s2) > 0) {
+            continue;
+          } else if (!offA1H8(s1) && !offA1H8(s2)) {
+            bothOnDiagonal.push_back(std::make_pair(idx, s2));
+          } else {
+            mapKK[idx][s2] = code++;
+          }
+        }
+      }
+    }
+  }
+  for (auto &p : bothOnDiagonal) {
+    mapKK[p.first][p.second] = code++;
+  }
+
+  // binomial[k][n]: ways to choose k elements of n
+  memset(binomial, 0, sizeof(binomial));
+  binomial[0][0] = 1;
+  for (int n = 1; n < 64; n++) {
+    for (int k = 0; k < 6 && k <= n; k++) {
+      binomial[k][n] = (k > 0 ? binomial[k - 1][n - 1] : 0)
+                     + (k < n ? binomial[k][n - 1] : 0);
+    }
+  }
+
+  // mapPawns[s] encodes squares a2-h7 to 0..47, the leading pawn has
+  // the highest value: nearest to the edge, lowest rank
+  int availableSquares = 47;
+
+  for (int leadPawnsCnt = 1; leadPawnsCnt <= 5; leadPawnsCnt++) {
+    for (int f = 0; f < 4; f++) {
+      U64 idx = 0;
+
+      for (int r = 1; r <= 6; r++) {
+        int sq = r * 8 + f;
+
+        if (leadPawnsCnt == 1) {
+          mapPawns[sq] = availableSquares--;
+          mapPawns[flipFile(sq)] = availableSquares--;
+        }
+        leadPawnIdx[leadPawnsCnt][sq] = idx;
+        idx += binomial[leadPawnsCnt - 1][mapPawns[sq]];
+      }
+      leadPawnsSize[leadPawnsCnt][f] = idx;
+    }
+  }
+}
+
+bool fileExists(const std::string &fname) {
+  return access(fname.c_str(), R_OK) == 0;
+}
+
+// Adds table of the given pieces (in TB piece codes, 6 is king)
+// if its WDL file exists in one of the directories
+void addTable(const std::vector<std::string> &dirs, const std::vector<int> &pieces, int &wdlFound, int &dtzFound) {
+  std::string code;
+  for (int pt : pieces) code += TB_CHAR[pt];
+
+  size_t split = code.find('K', 1);
+  std::string white = code.substr(0, split);
+  std::string black = code.substr(split);
+  std::string name = white + "v" + black;
+
+  std::string dir;
+  for (auto &d : dirs) {
+    if (fileExists(d + "/" + name + ".rtbw")) {
+      dir = d;
+      break;
+    }
+  }
+  if (dir.empty()) return;
+
+  wdlFound++;
+  if (fileExists(dir + "/" + name + ".rtbz")) dtzFound++;
+
+  maxCardinality = std::max((int) pieces.size(), maxCardinality);
+
+  tables.emplace_back(WDL, name, dir);
+  TBTable &wdl = tables.back();
+
+  int wPawns = std::count(white.begin(), white.end(), 'P');
+  int bPawns = std::count(black.begin(), black.end(), 'P');
+
+  wdl.key = materialKey(white, black);
+  wdl.key2 = materialKey(black, white);
+  wdl.pieceCount = pieces.size();
+  wdl.hasPawns = wPawns + bPawns > 0;
+
+  for (auto side : {white, black}) {
+    for (char c : std::string("PNBRQ")) {
+      if (std::count(side.begin(), side.end(), c) == 1) wdl.hasUniquePieces = true;
+    }
+  }
+
+  // Leading color is the one with less pawns, as it gives better compression
+  bool c = !bPawns || (wPawns && bPawns >= wPawns);
+  wdl.pawnCount[0] = c ? wPawns : bPawns;
+  wdl.pawnCount[1] = c ? bPawns : wPawns;
+
+  tables.emplace_back(DTZ, name, dir);
+  TBTable &dtz = tables.back();
+  dtz.key = wdl.key;
+  dtz.key2 = wdl.key2;
+  dtz.pieceCount = wdl.pieceCount;
+  dtz.hasPawns = wdl.hasPawns;
+  dtz.hasUniquePieces = wdl.hasUniquePieces;
+  dtz.pawnCount[0] = wdl.pawnCount[0];
+  dtz.pawnCount[1] = wdl.pawnCount[1];
+
+  tableByKey[wdl.key]  = std::make_pair(&wdl, &dtz);
+  tableByKey[wdl.key2] = std::make_pair(&wdl, &dtz);
+}
+
+void releaseTables() {
+  for (auto &e : tables) {
+    if (e.baseAddress) munmap(e.baseAddress, e.mapping);
+  }
+  tableByKey.clear();
+  tables.clear();
+  maxCardinality = 0;
+}
+
+}
+
+namespace Syzygy {
+
+void init(const std::string &path) {
+  releaseTables();
+
+  if (path.empty() || path == "<empty>") return;
+
+  static bool encodingReady = false;
+  if (!encodingReady) {
+    initEncoding();
+    encodingReady = true;
+  }
+
+  std::vector<std::string> dirs;
+  size_t start = 0;
+  while (start <= path.size()) {
+    size_t end = path.find(PATH_SEPARATOR, start);
+    if (end == std::string::npos) end = path.size();
+    if (end > start) dirs.push_back(path.substr(start, end - start));
+    start = end + 1;
+  }
+
+  const int K = 6;
+  int wdlFound = 0, dtzFound = 0;
+
+  for (int p1 = 1; p1 < K; p1++) {
+    addTable(dirs, {K, p1, K}, wdlFound, dtzFound);
+
+    for (int p2 = 1; p2 <= p1; p2++) {
+      addTable(dirs, {K, p1, p2, K}, wdlFound, dtzFound);
+      addTable(dirs, {K, p1, K, p2}, wdlFound, dtzFound);
+
+      for (int p3 = 1; p3 < K; p3++) {
+        addTable(dirs, {K, p1, p2, K, p3}, wdlFound, dtzFound);
+      }
+
+      for (int p3 = 1; p3 <= p2; p3++) {
+        addTable(dirs, {K, p1, p2, p3, K}, wdlFound, dtzFound);
+
+        for (int p4 = 1; p4 <= p3; p4++) {
+          addTable(dirs, {K, p1, p2, p3, p4, K}, wdlFound, dtzFound);
+
+          for (int p5 = 1; p5 <= p4; p5++) {
+            addTable(dirs, {K, p1, p2, p3, p4, p5, K}, wdlFound, dtzFound);
+          }
+          for (int p5 = 1; p5 < K; p5++) {
+            addTable(dirs, {K, p1, p2, p3, p4, K, p5}, wdlFound, dtzFound);
+          }
+        }
+
+        for (int p4 = 1; p4 < K; p4++) {
+          addTable(dirs, {K, p1, p2, p3, K, p4}, wdlFound, dtzFound);
+
+          for (int p5 = 1; p5 <= p4; p5++) {
+            addTable(dirs, {K, p1, p2, p3, K, p4, p5}, wdlFound, dtzFound);
+          }
+        }
+      }
+
+      for (int p3 = 1; p3 <= p1; p3++) {
+        for (int p4 = 1; p4 <= (p1 == p3 ? p2 : p3); p4++) {
+          addTable(dirs, {K, p1, p2, K, p3, p4}, wdlFound, dtzFound);
+        }
+      }
+    }
+  }
+
+  std::cout << "info string Found " << wdlFound << " WDL and " << dtzFound << " DTZ tablebase files" << std::endl;
+}
+
+int maxPieces() {
+  return maxCardinality;
+}
+
+int probeWdl(const Board &board, ProbeState * result) {
+  *result = OK;
+  return search(board, result, false);
+}
+
+int probeDtz(const Board &board, ProbeState * result) {
+  *result = OK;
+  int wdl = search(board, result, true);
+
+  // DTZ tables do not store draws
+  if (*result == FAIL || wdl == WDL_DRAW) return 0;
+
+  // DTZ stores a "don't care" value if the best move is zeroing
+  if (*result == ZEROING_BEST_MOVE) return dtzBeforeZeroing(wdl);
+
+  int dtz = probeTable(board, DTZ, result, wdl);
+
+  if (*result == FAIL) return 0;
+
+  if (*result != CHANGE_STM) {
+    return (dtz + 100 * (wdl == WDL_BLESSED_LOSS || wdl == WDL_CURSED_WIN)) * signOf(wdl);
+  }
+
+  // Table stores the other side to move: take the best move
+  // by a 1-ply search
+  int minDTZ = 0xFFFF;
+
+  MoveList moves;
+  MoveGen(&board, false, &moves);
+
+  for (auto &move : moves) {
+    Board child = board;
+    if (!child.doMove(move)) continue;
+
+    bool zeroing = isZeroing(move);
+
+    // For zeroing moves DTZ is taken from the WDL of the position after them
+    dtz = zeroing ? -dtzBeforeZeroing(search(child, result, false))
+                  : -probeDtz(child, result);
+
+    // Mating move
+    if (dtz == 1 && isMate(child)) minDTZ = 1;
+
+    if (!zeroing) dtz += signOf(dtz);
+
+    // Skip draws, if we are winning pick only positive DTZ
+    if (dtz < minDTZ && signOf(dtz) == signOf(wdl)) minDTZ = dtz;
+
+    if (*result == FAIL) return 0;
+  }
+
+  // No legal moves: the position is mate
+  return minDTZ == 0xFFFF ? -1 : minDTZ;
+}
+
+bool rootProbe(const Board &board, std::vector<RootMove> &rootMoves) {
+  ProbeState result = OK;
+  int cnt50 = board.getHalfmoveClock();
+  const int BOUND = 900;
+
+  for (auto &rm : rootMoves) {
+    Board child = board;
+    child.doMove(rm.move);
+
+    int dtz;
+    if (child.getHalfmoveClock() == 0) {
+      // Zeroing move: dtz is one of -101/-1/0/1/101
+      dtz = dtzBeforeZeroing(-probeWdl(child, &result));
+    } else {
+      // Take dtz of the new position and correct by 1 ply
+      dtz = -probeDtz(child, &result);
+      dtz = dtz > 0 ? dtz + 1 : dtz < 0 ? dtz - 1 : dtz;
+    }
+
+    if (dtz == 2 && isMate(child)) dtz = 1;
+
+    if (result == FAIL) return false;
+
+    // Wins within the 50-move rule are ranked equally,
+    // losses too unless 50-move draw is in sight
+    int r = dtz > 0 ? (dtz + cnt50 <= 99 ? 1000 : 1000 - (dtz + cnt50))
+          : dtz < 0 ? (-dtz * 2 + cnt50 < 100 ? -1000 : -1000 + (-dtz + cnt50))
+          : 0;
+    rm.tbRank = r;
+
+    // Cursed wins get at least 3 cp, growing as the win gets closer
+    rm.tbScore = r >= BOUND ? TB_WIN_SCORE
+               : r > 0      ? (std::max(3, r - 800) * 100) / 200
+               : r == 0     ? 0
+               : r > -BOUND ? (std::min(-3, r + 800) * 100) / 200
+               :             -TB_WIN_SCORE;
+  }
+
+  return true;
+}
+
+bool rootProbeWdl(const Board &board, std::vector<RootMove> &rootMoves) {
+  const int WDL_TO_RANK[]  = {-1000, -899, 0, 899, 1000};
+  const int WDL_TO_SCORE[] = {-TB_WIN_SCORE, -2, 0, 2, TB_WIN_SCORE};
+
+  ProbeState result = OK;
+
+  for (auto &rm : rootMoves) {
+    Board child = board;
+    child.doMove(rm.move);
+
+    int wdl = -probeWdl(child, &result);
+
+    if (result == FAIL) return false;
+
+    rm.tbRank = WDL_TO_RANK[wdl + 2];
+    rm.tbScore = WDL_TO_SCORE[wdl + 2];
+  }
+
+  return true;
+}
+
+}
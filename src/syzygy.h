@@ -0,0 +1,119 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef SYZYGY_H
+#define SYZYGY_H
+
+#include "defs.h"
+#include "board.h"
+#include "searchdata.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Probing of Syzygy endgame tablebases.
+ *
+ * Table files (.rtbw for WDL, .rtbz for DTZ) are memory mapped on the first
+ * probe of the material they cover. Decoding follows the Syzygy format
+ * by Ronald de Man. Castling positions are not in the tables,
+ * so callers must not probe positions with castling rights.
+ */
+namespace Syzygy {
+
+/**
+ * @brief Win/draw/loss of the side to move, cursed win and blessed loss
+ * are wins and losses that are draws by the 50-move rule.
+ */
+enum WDLScore {
+  WDL_LOSS         = -2,
+  WDL_BLESSED_LOSS = -1,
+  WDL_DRAW         =  0,
+  WDL_CURSED_WIN   =  1,
+  WDL_WIN          =  2
+};
+
+/**
+ * @brief Result of a probe
+ */
+enum ProbeState {
+  FAIL              =  0, /**< Probe failed (missing or corrupted table) */
+  OK                =  1, /**< Probe successful */
+  CHANGE_STM        = -1, /**< DTZ table stores the other side to move */
+  ZEROING_BEST_MOVE =  2  /**< Best move zeroes the 50-move counter */
+};
+
+/**
+ * @brief Finds tablebase files in the given directories.
+ *
+ * Directories are separated by ':' (';' on Windows), empty string
+ * or "<empty>" disables tablebases.
+ *
+ * @param path Directories with table files
+ */
+void init(const std::string &);
+
+/**
+ * @brief Largest number of pieces (kings included) of found tables
+ */
+int maxPieces();
+
+/**
+ * @brief Probes WDL tables for the given position.
+ *
+ * @param board Position to probe, number of pieces should not exceed maxPieces()
+ * @param result Set to FAIL if probe failed
+ * @return WDLScore of the side to move
+ */
+int probeWdl(const Board &, ProbeState *);
+
+/**
+ * @brief Probes DTZ tables for the given position.
+ *
+ * Returns distance to zeroing of the 50-move counter (capture or pawn move)
+ * in plies: positive if the side to move wins, negative if it loses,
+ * 0 for draws. Values beyond 100 (counting the current 50-move counter)
+ * are cursed wins or blessed losses.
+ *
+ * @param board Position to probe
+ * @param result Set to FAIL if probe failed
+ * @return DTZ of the position
+ */
+int probeDtz(const Board &, ProbeState *);
+
+/**
+ * @brief Ranks root moves by DTZ tables.
+ *
+ * Sets tbRank and tbScore of every root move. Moves that keep the win
+ * within the 50-move rule get the highest rank, moves that lose get the lowest.
+ *
+ * @param board Root position
+ * @param rootMoves Legal moves of the root position
+ * @return false if some probe failed
+ */
+bool rootProbe(const Board &, std::vector<RootMove> &);
+
+/**
+ * @brief Ranks root moves by WDL tables, used when DTZ tables are missing.
+ *
+ * @param board Root position
+ * @param rootMoves Legal moves of the root position
+ * @return false if some probe failed
+ */
+bool rootProbeWdl(const Board &, std::vector<RootMove> &);
+}
+
+#endif
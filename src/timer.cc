@@ -21,28 +21,33 @@
 
 Timer::Timer(Limits l, Color color, int movenum){
     _limits = l;
-    _wasThoughtProlonged = false;
     _moveTimeMode = false;
+    _ponder = _limits.ponder;
+    _prevBestMove = 0;
+    _prevScore = 0;
+    _stability = 0;
+    _softLimit = INF;
+    _hardLimit = INF;
+    _lastCheckTime = 0;
     if (_limits.infinite) { // Infinite search
         _searchDepth = INF;
-        _timeAllocated = INF;
     } else if (_limits.depth != 0) { // Depth search
         _searchDepth = _limits.depth;
-        _timeAllocated = INF;
     } else if (_limits.moveTime != 0) {
         _searchDepth = MAX_SEARCH_DEPTH;
-        _timeAllocated = _limits.moveTime - 10;
+        _softLimit = std::max(1, _limits.moveTime - _limits.moveOverhead);
+        _hardLimit = _softLimit;
         _moveTimeMode = true;
     } else if (_limits.time[color] != 0) {
         _setupTimer(color, movenum);
     } else { // No limits specified, use default depth
         _searchDepth = DEFAULT_SEARCH_DEPTH;
-        _timeAllocated = INF;
     }
 }
 
 void Timer::_setupTimer(Color color, int movenum){
-    int ourTime = _limits.time[color];
+    // Reserve time for the GUI/network lag
+    int ourTime = std::max(1, _limits.time[color] - _limits.moveOverhead);
     //int opponentTime = _limits.time[_initialBoard.getInactivePlayer()];
     int ourIncrement = _limits.increment[color];
     double tCoefficient = 0;
@@ -51,99 +56,115 @@ void Timer::_setupTimer(Color color, int movenum){
     // sudden death)
     if (_limits.movesToGo == 0) {
       tCoefficient = INCR_T_WIDTH_A / pow((INCR_T_WIDTH + pow((movenum - INCR_T_MOVE), 2)), 1.5);
-      _timeAllocated = ourTime * tCoefficient;
+      _softLimit = ourTime * tCoefficient;
       if (movenum > INCR_CRIT_MOVE){
           int div = ourIncrement != 0 ? MTG_CYC_INCR : MTG_NO_INCR;
-          _timeAllocated = ourTime / div + ourIncrement;
+          _softLimit = ourTime / div + ourIncrement;
       }
-      _timeAllocated = std::min(_timeAllocated, ourTime - 10);
     } else {
       // when movetogo is specified, use different coefficients
 
       tCoefficient = CYCL_T_WIDTH_A / pow((CYCL_T_WIDTH + pow((movenum - CYCL_T_MOVE), 2)), 1.5);
-      _timeAllocated = ourTime * tCoefficient;
-      if (movenum > CYCL_CRIT_MOVE) _timeAllocated = ourTime / MTG_CYC_INCR + ourIncrement;
-      _timeAllocated = std::min(_timeAllocated, ourTime - 10);
+      _softLimit = ourTime * tCoefficient;
+      if (movenum > CYCL_CRIT_MOVE) _softLimit = ourTime / MTG_CYC_INCR + ourIncrement;
     }
 
+    // Hard limit allows to finish the iteration that took longer than expected,
+    // but never uses most of our clock (no increment games)
+    int timeShare = (long long) ourTime * HARD_TIME_SHARE / 100;
+    _hardLimit = std::max(1, std::min(_softLimit * HARD_SOFT_RATIO, timeShare));
+    _softLimit = std::max(1, std::min(_softLimit, _hardLimit));
+
     // Depth is infinity in a timed search (ends when time runs out)
     _searchDepth = MAX_SEARCH_DEPTH;
-    _ourTimeLeft = ourTime - _timeAllocated;
 }
 
 bool Timer::checkLimits(U64 nodes){
 
-  int elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _start).count();
-
   if (_limits.nodes != 0 && (nodes >= _limits.nodes)) return true;
-  if (_moveTimeMode){
-    if (elapsed >= (_timeAllocated)) return true;
-    return false;
-  }
-
-  // when searching at a time control we will try to use time efficiatnly.
-  // If we already started the search, but it took way longer than expected
-  // we actually do not want to lose all of our effort
-  // So we check if we have enough time to actually finish it
-  // If we have much time left, we will allocate some more
-  // time to finish search and set a flag that search was prolonged
-  // so we didnt prolong it again.
-
-  if (_wasThoughtProlonged && elapsed >= (_timeAllocated)){
-    return true;
-  } else  if (elapsed >= (_timeAllocated)){
-
-    // if we have so much time left that we supposedly
-    // can search last ply ~25 times at least
-    // we can prolong thought here.
-    if (_ourTimeLeft > _lastPlyTime * 20 + 30 ){
-      _timeAllocated += _lastPlyTime * 2;
-      _wasThoughtProlonged = true;
-      return false;
-    }else{
-      return true;
-    }
+  if (_hardLimit == INF) return false;
 
-  }
+  auto now = std::chrono::steady_clock::now();
+  _lastCheckTime = std::chrono::duration_cast<std::chrono::milliseconds>(now - _searchStart).count();
+  if (_ponder) return false;
 
-  return false;
+  int elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - _start).count();
+
+  return elapsed >= _hardLimit;
 }
 
 void Timer::startIteration(){
     _start = std::chrono::steady_clock::now();
-    _lastPlyTime = 0;
+    _searchStart = _start;
+}
+
+void Timer::ponderHit(){
+    _ponder = false;
+
+    // Limits still count from "go ponder": time spent pondering is credited
+    // against the soft limit. Our clock runs only since ponderhit, so the
+    // hard limit is moved by the pondering time.
+    if (_hardLimit != INF){
+        int pondered = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _start).count();
+        _hardLimit = std::min((long long) INF, (long long) _hardLimit + pondered);
+    }
+}
+
+bool Timer::isPondering(){
+    return _ponder;
 }
 
-bool Timer::finishOnThisDepth(int * elapsedTime, U64 totalNodes, U64 bestNodes){
+bool Timer::finishOnThisDepth(int * elapsedTime, U64 totalNodes, U64 bestNodes, int bestMove, int score){
     int elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _start).count();
-    *elapsedTime = elapsed;
-    if (_moveTimeMode) return false;
+    *elapsedTime = getElapsed();
 
-    _lastPlyTime =  elapsed - _lastPlyTime;
+    // Track best move stability and score changes
+    _stability = bestMove == _prevBestMove ? _stability + 1 : 0;
+    int scoreDrop = _prevScore - score;
+    _prevBestMove = bestMove;
+    _prevScore = score;
 
-    double nodesConfidance = bestNodes * 100.0 / totalNodes;
-    // clamp coeff between 25 and 75
+    if (_moveTimeMode || _ponder || _softLimit == INF) return false;
+
+    // Most nodes go into the best move - it is probably the right one
+    // clamp coeff between 25 and 85
     // we assume that standart case is about ~50% of nodes go in bestMove
+    double nodesConfidance = bestNodes * 100.0 / std::max(totalNodes, (U64) 1);
     nodesConfidance = std::max(25.0, nodesConfidance);
     nodesConfidance = std::min(85.0, nodesConfidance);
-
     double nodesCoeff = 1.0 + (51.0 - nodesConfidance) / 50.0;
 
+    // Best move is the same for many iterations - use less time
+    double stabilityCoeff = 1.3 - 0.06 * std::min(_stability, 10);
 
+    // Score is falling - position is critical, use more time
+    double scoreCoeff = 1.0 + std::max(0, std::min(scoreDrop, 100)) / 200.0;
 
+    double softScaled = std::min(_softLimit * nodesCoeff * stabilityCoeff * scoreCoeff, (double) _hardLimit);
 
-    *elapsedTime = elapsed;
-    if (_wasThoughtProlonged ||  (elapsed >= (_timeAllocated * nodesCoeff * 0.5))){
-        return true;
-    }
-
-    return false;
+    // next iteration usually takes longer than all previous ones,
+    // so do not start it if we already used half of the time
+    return elapsed >= softScaled * 0.5;
 }
 
 int Timer::getElapsed(){
-    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _start).count();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _searchStart).count();
+}
+
+bool Timer::hasNodeLimit(){
+    return _limits.nodes != 0;
+}
+
+U64 Timer::getPollInterval(U64 nodes){
+    // node limit: poll often, so the budget is not overstepped much
+    if (_limits.nodes != 0) return MIN_POLL_NODES;
+    // no time limit: clock is not needed
+    if (_hardLimit == INF) return MAX_POLL_NODES;
+
+    U64 nodesPerPeriod = nodes * POLL_PERIOD_MS / std::max(_lastCheckTime, 1);
+    return std::max((U64) MIN_POLL_NODES, std::min(nodesPerPeriod, (U64) MAX_POLL_NODES));
 }
 
 int Timer::getSearchDepth(){
     return _searchDepth;
-}
\ No newline at end of file
+}
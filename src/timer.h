@@ -20,6 +20,7 @@
 
 #include "defs.h"
 #include <chrono>
+#include <vector>
 
 
   /**
@@ -34,8 +35,13 @@
     int  time[2];       // time left for black and white
     int  increment[2];   // increment for black and white
     bool infinite;      // ignore limits (infinite search)
+    int  multiPV;       // number of principal variations to search
+    bool ponder;        // search in ponder mode, time control starts on ponderhit
+    std::vector<int> searchMoves;   // if not empty, search only these root moves (MOVE_INT)
+    int  moveOverhead;  // time reserved for communication lag per move
+    int  syzygyProbeLimit;  // largest number of pieces to probe tablebases for
 
-    Limits() : nodes(0), depth(0),  moveTime(0), movesToGo(0), time{}, increment{}, infinite(false) {};
+    Limits() : nodes(0), depth(0),  moveTime(0), movesToGo(0), time{}, increment{}, infinite(false), multiPV(1), ponder(false), moveOverhead(10), syzygyProbeLimit(7) {};
   };
 
   class Timer
@@ -49,34 +55,43 @@
     Limits _limits;
 
     /**
-     * @brief Time allocated for this search in ms
+     * @brief Soft time limit for this search in ms.
      *
+     * Time we expect to spend on this move. It is scaled after every
+     * iteration (finishOnThisDepth) and is not checked in the middle
+     * of the iteration.
      */
-    int _timeAllocated;
+    int _softLimit;
 
     /**
-     * @brief This variable holds value of how much time left on our
-     * clock. If it is too low, we do not prolong search.
+     * @brief Hard time limit for this search in ms.
      *
+     * Search is stopped immediately when it is reached (checkLimits).
      */
-    int _ourTimeLeft;
+    int _hardLimit;
+
+    bool _moveTimeMode;
 
     /**
-     * @brief We keep track of times we prolonged thought
-     * during the search. It is important to not prolong a more
-     * than one in a row in order not to lose on time.
-     *
+     * @brief True while search is pondering: time limits are ignored
+     * until ponderHit() is called.
      */
-    bool _wasThoughtProlonged;
+    bool _ponder;
 
-    bool _moveTimeMode;
+    /**
+     * @brief Best move and score of the previous iteration and
+     * number of iterations in a row best move stays the same.
+     * Used to scale soft limit.
+     */
+    int _prevBestMove;
+    int _prevScore;
+    int _stability;
 
     /**
-     *  @brief We track how much time we spended while
-     *  searching last ply. It is used to estimate how much time
-     *  we grant engine when search be prolonged.
+     * @brief Time since search start measured on the last checkLimits() call,
+     * used to estimate search speed
      */
-    int _lastPlyTime;
+    int _lastCheckTime;
 
     /**
      * @brief Depth of this search in plys
@@ -84,14 +99,21 @@
     int _searchDepth;
 
     /**
-     * @brief time_point object representing the exact moment this search was started.
+     * @brief time_point object representing the exact moment our clock started
+     * (search start, also when pondering).
      *
      */
     std::chrono::time_point<std::chrono::steady_clock> _start;
 
+    /**
+     * @brief time_point object representing the exact moment this search was started.
+     *
+     */
+    std::chrono::time_point<std::chrono::steady_clock> _searchStart;
+
     /**
      * @brief Constants used for time management.
-     * General time calculations formula (Where MOVENUM is current move number in the game):
+     * General time calculations formula for the soft limit (Where MOVENUM is current move number in the game):
      *
      * movenum <= critical_move:
      *                                        tWidth_a
@@ -105,21 +127,30 @@
      *
      * We use separate sets of constants cyclic and increment time controls
      *
+     * Hard limit is HARD_SOFT_RATIO times soft limit, but no more than
+     * HARD_TIME_SHARE percent of our time.
+     *
      * @{
      */
-      const int INCR_T_WIDTH_A = 322;
-      const int INCR_T_WIDTH   = 188;
-      const int INCR_T_MOVE    = 22;
-      const int INCR_CRIT_MOVE = 26;
+      static const int INCR_T_WIDTH_A = 322;
+      static const int INCR_T_WIDTH   = 188;
+      static const int INCR_T_MOVE    = 22;
+      static const int INCR_CRIT_MOVE = 26;
+
+      static const int CYCL_T_WIDTH_A = 750;
+      static const int CYCL_T_WIDTH   = 200;
+      static const int CYCL_T_MOVE    = 35;
+      static const int CYCL_CRIT_MOVE = 20;
 
-      const int CYCL_T_WIDTH_A = 750;
-      const int CYCL_T_WIDTH   = 200;
-      const int CYCL_T_MOVE    = 35;
-      const int CYCL_CRIT_MOVE = 20;
+      static const int MTG_CYC_INCR   = 5;
+      static const int MTG_NO_INCR    = 40;
 
-      const int MTG_CYC_INCR   = 5;
-      const int MTG_NO_INCR    = 40;
+      static const int HARD_SOFT_RATIO = 4;
+      static const int HARD_TIME_SHARE = 75;
 
+      static const int POLL_PERIOD_MS  = 2;
+      static const int MIN_POLL_NODES  = 1024;
+      static const int MAX_POLL_NODES  = 65536;
 
     /**@}*/
 
@@ -129,15 +160,55 @@
   public:
       Timer(Limits, Color, int);
 
+      /**
+       * @brief Returns true if search should be stopped right now
+       * (hard time limit or node limit reached)
+       */
       bool checkLimits(U64);
 
+      bool hasNodeLimit();
+
+      /**
+       * @brief Returns number of nodes to search before the next checkLimits() call.
+       *
+       * Without a time limit clock is not used at all. With it interval is derived
+       * from the measured speed, so clock is polled about every POLL_PERIOD_MS.
+       *
+       * @param nodes nodes searched by the polling thread
+       */
+      U64 getPollInterval(U64);
+
       void startIteration();
 
-      bool finishOnThisDepth(int *, U64, U64);
+      /**
+       * @brief Called after each completed iteration, returns true
+       * if next iteration should not be started.
+       *
+       * Soft limit is scaled by the share of nodes spent on the best move,
+       * by the best move stability and by the score drop since previous iteration.
+       *
+       * @param elapsedTime   returns time since search start
+       * @param totalNodes    nodes spent in the search
+       * @param bestNodes     nodes spent on the best move
+       * @param bestMove      best move of the iteration (MOVE_INT)
+       * @param score         score of the iteration
+       */
+      bool finishOnThisDepth(int *, U64, U64, int, int);
 
       int getSearchDepth();
 
       int getElapsed();
+
+      /**
+       * @brief Switches pondering search to the normal time allocation.
+       *
+       * Time limits keep counting from the search start, so pondering time
+       * is used as our own, hard limit is moved by the pondering time
+       * to stay within the clock that starts at this moment.
+       */
+      void ponderHit();
+
+      bool isPondering();
   };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,479 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "train.h"
+#include "nnue.h"
+#include "packedpos.h"
+#include "cmdargs.h"
+#include <cmath>
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <iostream>
+#include <fstream>
+#include <functional>
+#include <vector>
+#include <thread>
+#include <random>
+#include <algorithm>
+
+const int TRAIN_FEATURES = NNUE_INPUT * NNUE_BUCKETS;
+
+// Hidden weights are clipped so that 32 pieces and the bias
+// can not overflow int16 accumulator of the quantized net
+const float TRAIN_HIDDEN_CLIP = 1.9f;
+
+// Output bias, in sigmoid units
+const float TRAIN_BIAS_CLIP = 100.0f;
+
+const float ADAM_BETA1   = 0.9f;
+const float ADAM_BETA2   = 0.999f;
+const float ADAM_EPSILON = 1e-8f;
+
+namespace {
+
+struct TrainSettings {
+    std::string data;
+    int         threads;
+    std::string net;
+    std::string init;
+    int         epochs;
+    int         batch;
+    float       lr;
+    int         drop;
+    float       wdl;
+    float       scale;
+    U64         seed;
+    bool        chains;
+
+    TrainSettings() : threads(1), net("trained.nnue"), epochs(TRAIN_EPOCHS), batch(TRAIN_BATCH),
+                      lr(TRAIN_LR), drop(0), wdl(TRAIN_WDL), scale(TRAIN_SCALE), seed(0), chains(false) {};
+};
+
+// Float network, output is in sigmoid units (centipawns / scale).
+// Output weights: side to move half first, then the other half.
+struct Network {
+    std::vector<float> hiddenWeight;
+    std::vector<float> hiddenBias;
+    std::vector<float> outputWeight;
+    std::vector<float> outputBias;
+
+    Network() : hiddenWeight(TRAIN_FEATURES * NNUE_HIDDEN), hiddenBias(NNUE_HIDDEN),
+                outputWeight(2 * NNUE_HIDDEN), outputBias(1) {};
+};
+
+// Features of both perspectives (side to move first) and the target
+struct Sample {
+    int   features[2][32];
+    int   count;
+    float target;
+};
+
+// Positions of a packed file (memory mapped), of a chain file or of a text file
+class TrainData {
+ public:
+    void open(const std::string &path, bool chains){
+        if (chains){
+            PackedReader reader;
+            reader.open(path);
+
+            std::vector<PackedPos> positions;
+            while (reader.readChain(positions)){
+                _loaded.insert(_loaded.end(), positions.begin(), positions.end());
+            }
+            return;
+        }
+
+        std::ifstream file(path);
+        if (!file){
+            fatal("Failed to open " + path);
+        }
+
+        std::string line;
+        PackedPos pos;
+        if (!std::getline(file, line) || !Packed::fromText(line, pos)){
+            _packed.open(path);
+            return;
+        }
+
+        do {
+            if (Packed::fromText(line, pos)) _loaded.push_back(pos);
+        } while (std::getline(file, line));
+    }
+
+    U64 size() const {
+        return _loaded.empty() ? _packed.size() : _loaded.size();
+    }
+
+    const PackedPos &operator[](U64 index) const {
+        return _loaded.empty() ? _packed[index] : _loaded[index];
+    }
+
+ private:
+    PackedFile _packed;
+    std::vector<PackedPos> _loaded;   // positions of a text or chain file
+};
+
+float sigmoid(float x){
+    return 1.0f / (1.0f + std::exp(-x));
+}
+
+// Runs fn(begin, end, thread) on parts of [0, count) in parallel
+void parallelFor(int threads, size_t count, const std::function<void(size_t, size_t, int)> &fn){
+    std::vector<std::thread> workers;
+    size_t part = (count + threads - 1) / threads;
+    for (int t = 1; t < threads && t * part < count; t++){
+        workers.push_back(std::thread(fn, t * part, std::min(count, (t + 1) * part), t));
+    }
+    fn(0, std::min(count, part), 0);
+    for (auto &w : workers){
+        w.join();
+    }
+}
+
+// Returns false if the position has no kings
+bool makeSample(const PackedPos &pos, NNueEvaluation &nnue, const TrainSettings &settings, Sample &sample){
+    int squares[32], count = 0, kings[2] = {-1, -1};
+    PieceType types[32];
+    Color colors[32];
+
+    U64 occupied = pos.occupied;
+    for (int i = 0; occupied && i < 32; i++){
+        int square = _popLsb(occupied);
+        int code = (pos.pieces[i / 2] >> (4 * (i % 2))) & 15;
+
+        if (code == PACKED_EP_PAWN){
+            // white pawn after double push is on the 4th rank
+            code = _row(square) == 3 ? PAWN : PAWN + 6;
+        }else if (code == PACKED_WHITE_CROOK || code == PACKED_BLACK_CROOK){
+            code = code == PACKED_WHITE_CROOK ? ROOK : ROOK + 6;
+        }
+
+        squares[count] = square;
+        types[count]   = PieceType(code % 6);
+        colors[count]  = Color(code / 6);
+        if (types[count] == KING) kings[colors[count]] = square;
+        count++;
+    }
+    if (kings[WHITE] < 0 || kings[BLACK] < 0) return false;
+
+    Color stm = Packed::getActivePlayer(pos);
+    Color views[2] = {stm, getOppositeColor(stm)};
+    for (int v = 0; v < 2; v++){
+        for (int i = 0; i < count; i++){
+            sample.features[v][i] = nnue.getFeatureIndex(squares[i], types[i], colors[i], views[v], kings[views[v]]);
+        }
+    }
+    sample.count = count;
+
+    float result = Packed::getResult(pos) / 2.0f;
+    if (stm == BLACK) result = 1.0f - result;
+    sample.target = (1.0f - settings.wdl) * sigmoid(pos.score / settings.scale) + settings.wdl * result;
+    return true;
+}
+
+// Adam update of n parameters, gradient is cleared
+void adam(float *weight, float *grad, float *m, float *v, int n, float lr, float clip){
+    for (int i = 0; i < n; i++){
+        m[i] = ADAM_BETA1 * m[i] + (1.0f - ADAM_BETA1) * grad[i];
+        v[i] = ADAM_BETA2 * v[i] + (1.0f - ADAM_BETA2) * grad[i] * grad[i];
+        weight[i] -= lr * m[i] / (std::sqrt(v[i]) + ADAM_EPSILON);
+        weight[i] = std::max(-clip, std::min(weight[i], clip));
+        grad[i] = 0.0f;
+    }
+}
+
+void randomNetwork(Network &net, U64 seed){
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<float> hidden(-1.0f / std::sqrt(32.0f), 1.0f / std::sqrt(32.0f));
+    std::uniform_real_distribution<float> output(-1.0f / std::sqrt(2.0f * NNUE_HIDDEN), 1.0f / std::sqrt(2.0f * NNUE_HIDDEN));
+
+    for (auto &w : net.hiddenWeight) w = hidden(rng);
+    for (auto &w : net.outputWeight) w = output(rng);
+}
+
+template <typename T>
+T readValue(std::ifstream &file){
+    T value = 0;
+    file.read(reinterpret_cast<char *>(&value), sizeof(value));
+    return value;
+}
+
+template <typename T>
+void writeValue(std::ofstream &file, double value, double limit){
+    T q = (T) std::round(std::max(-limit, std::min(value, limit)));
+    file.write(reinterpret_cast<const char *>(&q), sizeof(q));
+}
+
+// Network file layout is the one NNueEvaluation::init reads
+void loadNetwork(Network &net, const std::string &path, float scale){
+    std::ifstream file(path, std::ios::binary);
+    if (!file){
+        fatal("Failed to open " + path);
+    }
+
+    for (auto &w : net.hiddenWeight) w = readValue<int16_t>(file) / (float) NNUE_QA;
+    for (auto &w : net.hiddenBias)   w = readValue<int16_t>(file) / (float) NNUE_QA;
+    for (auto &w : net.outputWeight) w = readValue<int16_t>(file) / (NNUE_QB * scale);
+    net.outputBias[0] = readValue<int32_t>(file) / (NNUE_SCALE * scale);
+
+    if (!file){
+        fatal("Network file " + path + " is too short");
+    }
+}
+
+void saveNetwork(const Network &net, const std::string &path, float scale){
+    std::ofstream file(path, std::ios::binary);
+    if (!file){
+        fatal("Failed to open " + path);
+    }
+
+    for (auto w : net.hiddenWeight) writeValue<int16_t>(file, w * NNUE_QA, INT16_MAX);
+    for (auto w : net.hiddenBias)   writeValue<int16_t>(file, w * NNUE_QA, INT16_MAX);
+    for (auto w : net.outputWeight) writeValue<int16_t>(file, w * NNUE_QB * scale, INT16_MAX);
+    writeValue<int32_t>(file, (double) net.outputBias[0] * NNUE_SCALE * scale, INT32_MAX);
+}
+
+class Trainer {
+ public:
+    Trainer(Network &net, const TrainSettings &settings) : _net(net), _settings(settings), _step(0),
+        _mHidden(TRAIN_FEATURES * NNUE_HIDDEN), _vHidden(TRAIN_FEATURES * NNUE_HIDDEN),
+        _gradHidden(TRAIN_FEATURES * NNUE_HIDDEN), _touched(TRAIN_FEATURES),
+        _m(NNUE_HIDDEN + 2 * NNUE_HIDDEN + 1), _v(_m.size()), _grad(_m.size()),
+        _threadGrad(settings.threads, std::vector<float>(2 * NNUE_HIDDEN + 1)),
+        _threadLoss(settings.threads), _samples(settings.batch),
+        _gradAcc((size_t) settings.batch * 2 * NNUE_HIDDEN) {};
+
+    // Trains on the given positions, returns sum of the losses
+    double batch(const TrainData &data, const uint32_t *indexes, int size, float lr){
+        std::fill(_threadLoss.begin(), _threadLoss.end(), 0.0);
+        _forward(data, indexes, size);
+        _backward(size);
+        _update(lr);
+
+        double loss = 0;
+        for (auto l : _threadLoss) loss += l;
+        return loss;
+    }
+
+ private:
+    Network &_net;
+    const TrainSettings &_settings;
+    int _step;
+
+    // Adam state of the hidden weights, only used rows are updated
+    std::vector<float> _mHidden, _vHidden, _gradHidden;
+    std::vector<uint8_t> _touched;
+    std::vector<int> _touchedRows;
+
+    // Adam state of hidden bias, output weights and output bias
+    std::vector<float> _m, _v, _grad;
+
+    std::vector<std::vector<float>> _threadGrad;
+    std::vector<double> _threadLoss;
+    std::vector<Sample> _samples;
+
+    // Loss gradient by the accumulators of every sample
+    std::vector<float> _gradAcc;
+
+    // Every thread evaluates its samples, output layer gradient is summed per thread
+    void _forward(const TrainData &data, const uint32_t *indexes, int size){
+        parallelFor(_settings.threads, size, [&](size_t begin, size_t end, int t){
+            NNueEvaluation nnue;
+            std::vector<float> &grad = _threadGrad[t];
+            float acc[2][NNUE_HIDDEN];
+
+            for (size_t s = begin; s < end; s++){
+                Sample &sample = _samples[s];
+                float *gradAcc = &_gradAcc[s * 2 * NNUE_HIDDEN];
+                if (!makeSample(data[indexes[s]], nnue, _settings, sample)){
+                    sample.count = 0;
+                    std::fill(gradAcc, gradAcc + 2 * NNUE_HIDDEN, 0.0f);
+                    continue;
+                }
+
+                float output = _net.outputBias[0];
+                for (int v = 0; v < 2; v++){
+                    std::copy(_net.hiddenBias.begin(), _net.hiddenBias.end(), acc[v]);
+                    for (int i = 0; i < sample.count; i++){
+                        const float *row = &_net.hiddenWeight[(size_t) sample.features[v][i] * NNUE_HIDDEN];
+                        for (int h = 0; h < NNUE_HIDDEN; h++) acc[v][h] += row[h];
+                    }
+                    const float *weight = &_net.outputWeight[v * NNUE_HIDDEN];
+                    for (int h = 0; h < NNUE_HIDDEN; h++) output += std::max(acc[v][h], 0.0f) * weight[h];
+                }
+
+                // mean squared error of the win probability
+                float predicted = sigmoid(output);
+                float error = predicted - sample.target;
+                float gradOutput = 2.0f * error * predicted * (1.0f - predicted) / size;
+                _threadLoss[t] += error * error;
+
+                for (int v = 0; v < 2; v++){
+                    const float *weight = &_net.outputWeight[v * NNUE_HIDDEN];
+                    float *gradWeight = &grad[v * NNUE_HIDDEN];
+                    float *gradA = gradAcc + v * NNUE_HIDDEN;
+                    for (int h = 0; h < NNUE_HIDDEN; h++){
+                        gradWeight[h] += gradOutput * std::max(acc[v][h], 0.0f);
+                        gradA[h] = acc[v][h] > 0.0f ? gradOutput * weight[h] : 0.0f;
+                    }
+                }
+                grad[2 * NNUE_HIDDEN] += gradOutput;
+            }
+        });
+    }
+
+    // Hidden layer gradient is summed by every thread for its own part of the hidden neurons
+    void _backward(int size){
+        _touchedRows.clear();
+        for (int s = 0; s < size; s++){
+            for (int v = 0; v < 2; v++){
+                for (int i = 0; i < _samples[s].count; i++){
+                    int row = _samples[s].features[v][i];
+                    if (!_touched[row]) _touchedRows.push_back(row);
+                    _touched[row] = 1;
+                }
+            }
+        }
+
+        const int chunks = NNUE_HIDDEN / 16;
+        parallelFor(_settings.threads, chunks, [&](size_t begin, size_t end, int){
+            int from = begin * 16, to = end * 16;
+            for (int s = 0; s < size; s++){
+                for (int v = 0; v < 2; v++){
+                    const float *gradA = &_gradAcc[((size_t) s * 2 + v) * NNUE_HIDDEN];
+                    for (int h = from; h < to; h++) _grad[h] += gradA[h];
+                    for (int i = 0; i < _samples[s].count; i++){
+                        float *gradRow = &_gradHidden[(size_t) _samples[s].features[v][i] * NNUE_HIDDEN];
+                        for (int h = from; h < to; h++) gradRow[h] += gradA[h];
+                    }
+                }
+            }
+        });
+
+        for (auto &grad : _threadGrad){
+            for (int i = 0; i < 2 * NNUE_HIDDEN + 1; i++) _grad[NNUE_HIDDEN + i] += grad[i];
+            std::fill(grad.begin(), grad.end(), 0.0f);
+        }
+    }
+
+    void _update(float lr){
+        _step++;
+        float stepLr = lr * std::sqrt(1.0f - std::pow(ADAM_BETA2, _step)) / (1.0f - std::pow(ADAM_BETA1, _step));
+
+        parallelFor(_settings.threads, _touchedRows.size(), [&](size_t begin, size_t end, int){
+            for (size_t i = begin; i < end; i++){
+                size_t offset = (size_t) _touchedRows[i] * NNUE_HIDDEN;
+                adam(&_net.hiddenWeight[offset], &_gradHidden[offset], &_mHidden[offset], &_vHidden[offset],
+                     NNUE_HIDDEN, stepLr, TRAIN_HIDDEN_CLIP);
+                _touched[_touchedRows[i]] = 0;
+            }
+        });
+
+        // output weights are limited by int16 range after quantization
+        float outputClip = INT16_MAX / (NNUE_QB * _settings.scale);
+        adam(&_net.hiddenBias[0], &_grad[0], &_m[0], &_v[0], NNUE_HIDDEN, stepLr, TRAIN_HIDDEN_CLIP);
+        adam(&_net.outputWeight[0], &_grad[NNUE_HIDDEN], &_m[NNUE_HIDDEN], &_v[NNUE_HIDDEN],
+             2 * NNUE_HIDDEN, stepLr, outputClip);
+        adam(&_net.outputBias[0], &_grad[3 * NNUE_HIDDEN], &_m[3 * NNUE_HIDDEN], &_v[3 * NNUE_HIDDEN],
+             1, stepLr, TRAIN_BIAS_CLIP);
+    }
+};
+
+}
+
+void train(int argCount, char* argValue[]){
+    if (argCount < 3){
+        std::cout << "Usage: train <data> [threads] [net] [epochs N] [batch N] [lr F] [drop N] [wdl F] [scale F] [init FILE] [seed N] [chain]" << std::endl;
+        return;
+    }
+
+    TrainSettings settings;
+    settings.data = argValue[2];
+
+    // positional: threads, net; keywords with values anywhere
+    CmdArgs args(argCount, argValue, 3, {"epochs", "batch", "lr", "drop", "wdl", "scale", "init", "seed"}, {"chain"});
+    settings.threads = args.positionalInt(0, settings.threads);
+    settings.net     = args.positional(1, settings.net);
+    settings.epochs  = args.getInt("epochs", settings.epochs);
+    settings.batch   = args.getInt("batch", settings.batch);
+    settings.lr      = args.getFloat("lr", settings.lr);
+    settings.drop    = args.getInt("drop", settings.drop);
+    settings.wdl     = args.getFloat("wdl", settings.wdl);
+    settings.scale   = args.getFloat("scale", settings.scale);
+    settings.init    = args.get("init", settings.init);
+    settings.seed    = args.getU64("seed", settings.seed);
+    settings.chains  = args.has("chain");
+
+    settings.threads = std::max(MIN_THREADS, std::min(settings.threads, MAX_THREADS));
+    settings.batch   = std::max(1, settings.batch);
+    settings.wdl     = std::max(0.0f, std::min(settings.wdl, 1.0f));
+    if (settings.scale <= 0){
+        fatal("Train scale should be positive");
+    }
+
+    TrainData data;
+    data.open(settings.data, settings.chains);
+    if (data.size() > UINT32_MAX){
+        fatal("Train data " + settings.data + " has too many positions");
+    }
+
+    // positions marked by datagen as not quiet are not trained on
+    std::vector<uint32_t> order;
+    for (U64 i = 0; i < data.size(); i++){
+        if (!(data[i].flags & PACKED_SKIP)) order.push_back(i);
+    }
+    if (order.empty()){
+        fatal("Train data " + settings.data + " has no positions");
+    }
+
+    std::unique_ptr<Network> net(new Network());
+    if (settings.init.empty()){
+        randomNetwork(*net, settings.seed);
+    }else{
+        loadNetwork(*net, settings.init, settings.scale);
+    }
+
+    std::cout << "Train: " << order.size() << " positions, " << settings.threads << " threads, batch "
+              << settings.batch << ", lr " << settings.lr << ", wdl " << settings.wdl
+              << ", scale " << settings.scale << std::endl;
+
+    std::unique_ptr<Trainer> trainer(new Trainer(*net, settings));
+    std::mt19937_64 rng(settings.seed);
+
+    for (int epoch = 1; epoch <= settings.epochs; epoch++){
+        float lr = settings.drop && epoch > settings.drop ? settings.lr / 10 : settings.lr;
+        std::shuffle(order.begin(), order.end(), rng);
+
+        std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now();
+        double loss = 0;
+        for (size_t i = 0; i < order.size(); i += settings.batch){
+            int size = std::min((size_t) settings.batch, order.size() - i);
+            loss += trainer->batch(data, &order[i], size, lr);
+        }
+        int elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+        saveNetwork(*net, settings.net, settings.scale);
+        printf("Epoch %3d  loss %.6f  lr %g  %8llu pos/s  %d ms\n", epoch, loss / order.size(), lr,
+               1000 * (U64) order.size() / std::max(1, elapsed), elapsed);
+        std::cout << std::flush;
+    }
+
+    if (settings.epochs <= 0){
+        saveNetwork(*net, settings.net, settings.scale);
+    }
+}
@@ -0,0 +1,46 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef TRAIN_H
+#define TRAIN_H
+
+#define TRAIN_EPOCHS        (10)
+#define TRAIN_BATCH         (16384)
+#define TRAIN_LR            (0.001)
+#define TRAIN_WDL           (0.25)
+#define TRAIN_SCALE         (400)
+
+/**
+ * @brief Trains the NNUE network of the engine on labeled positions
+ *
+ * Command line: train <data> [threads] [net] [epochs N] [batch N] [lr F] [drop N] [wdl F] [scale F] [init FILE] [seed N] [chain]
+ *
+ * Data is a packed position file (see PackedPos), a chain file of
+ * "datagen ... chain" with the "chain" option or a text file with
+ * "<FEN> | <score> | <result>" lines. Positions marked with PACKED_SKIP
+ * are not used. Target of a position is
+ * sigmoid(score / scale) mixed with the game result, "wdl" is the weight
+ * of the result. Network has the architecture NNueEvaluation uses and is
+ * trained in floats with Adam, starting from random weights or from the
+ * "init" net. Only rows of the input weights used by the batch are updated.
+ * Batches are split between threads, learning rate is divided by 10
+ * after "drop" epochs. After every epoch the network is saved (quantized,
+ * in the format NNueEvaluation::init reads) to the net file.
+ */
+void train(int, char* []);
+
+#endif
@@ -51,6 +51,11 @@ HASH::HASH(){
   pTableMask = pTableSize - 1;
 }
 
+HASH::~HASH(){
+  delete[] hashTable;
+  delete[] pHASH;
+}
+
 void  HASH::HASH_Initalize_MB(const int MB){
 
   //delete previous TT
@@ -32,6 +32,14 @@ class HASH{
 
   HASH();
 
+  /**
+   * @brief Frees TT and pawn hash table
+   */
+  ~HASH();
+
+  HASH(const HASH &) = delete;
+  HASH &operator=(const HASH &) = delete;
+
   void          HASH_Clear();
   void          HASH_Initalize_MB(const int MB);
   HASH_Entry    HASH_Get  (U64 posKey);
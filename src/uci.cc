@@ -21,8 +21,13 @@
 #include "eval.h"
 #include "searchdata.h"
 #include "timer.h"
+#include "stats.h"
+#include "syzygy.h"
+#include "endgame.h"
 #include <iostream>
 #include <thread>
+#include <vector>
+#include <algorithm>
 
 extern HASH         * myHASH;
 extern OrderingInfo * myOrdering;
@@ -36,9 +41,19 @@ std::thread     cThread[MAX_THREADS];
 namespace {
 Book book;
 std::shared_ptr<Search> search;
+std::thread searchThread;
 Board board;
 Hist positionHistory = Hist();
 
+// Stop signal shared by all threads of the current search
+std::atomic<bool> stopSignal(false);
+
+// Last "position" command, used to detect
+// commands that only append moves to the previous one
+std::string lastPositionBase;
+std::vector<std::string> lastPositionMoves;
+bool lastPositionFrc = false;
+
 void loadBook() {
   std::ifstream bookFile(optionsMap["BookPath"].getValue());
   bool bookOk = bookFile.good();
@@ -51,6 +66,14 @@ void loadBook() {
   }
 }
 
+void loadSyzygy() {
+  Syzygy::init(optionsMap["SyzygyPath"].getValue());
+}
+
+void loadBitbases() {
+  Bitbase::init_bitbases(optionsMap["BitbasePath"].getValue());
+}
+
 void changeTTsize(){
   int size = atoi(optionsMap["Hash"].getValue().c_str());
   // make sure we do not overstep bounds
@@ -70,9 +93,12 @@ void changeThreadsNumber(){
   myTHREADSCOUNT = tNum;
 
   // Create ordering for them
+  // Existing ones are kept, as helper Searches hold them
   if (myTHREADSCOUNT > 1){
     for (int i = 1; i < myTHREADSCOUNT; i++){
-      cOrdering[i] = new OrderingInfo();
+      if (cOrdering[i] == nullptr){
+        cOrdering[i] = new OrderingInfo();
+      }
     }
   }
 }
@@ -90,9 +116,15 @@ Eval::SetupTuning(QUEEN, atoi(optionsMap["cQueen"].getValue().c_str()));
 
 void initOptions() {
   optionsMap["OwnBook"] = Option(false);
+  optionsMap["Ponder"] = Option(false);
   optionsMap["BookPath"] = Option("book.bin", &loadBook);
   optionsMap["Hash"] = Option(MIN_HASH, MIN_HASH, MAX_HASH, &changeTTsize);
   optionsMap["Threads"] = Option(MIN_THREADS, MIN_THREADS, MAX_THREADS, &changeThreadsNumber);
+  optionsMap["MultiPV"] = Option(1, 1, MAX_MULTIPV);
+  optionsMap["Move Overhead"] = Option(10, 0, 5000);
+  optionsMap["SyzygyPath"] = Option("<empty>", &loadSyzygy);
+  optionsMap["SyzygyProbeLimit"] = Option(7, 0, 7);
+  optionsMap["BitbasePath"] = Option("<empty>", &loadBitbases);
   optionsMap["UCI_Chess960"] = Option(false);
 
 
@@ -116,46 +148,88 @@ void initOptions() {
 void uciNewGame() {
   board.setToStartPos();
   positionHistory = Hist();
+  lastPositionBase.clear();
+  lastPositionMoves.clear();
 }
 
 void setPosition(std::istringstream &is) {
   std::string token;
+  std::string base;
+  std::vector<std::string> moveTokens;
+  bool isFrc = optionsMap["UCI_Chess960"].getValue() == "true";
+
   is >> token;
 
   if (token == "startpos") {
-    board.setToStartPos();
+    base = token;
   } else {
-    std::string fen;
-
     while (is >> token && token != "moves") {
-      fen += token + " ";
+      base += token + " ";
     }
-
-    board.setToFen(fen, (optionsMap["UCI_Chess960"].getValue() == "true"));
   }
 
   while (is >> token) {
     if (token == "moves") {
       continue;
     }
+    moveTokens.push_back(token);
+  }
+
+  // GUIs resend the whole game on every move. If the new command only
+  // appends moves to the previous one, continue from the current board
+  // and replay just the new tail.
+  size_t firstNew = 0;
+  bool isContinuation = base == lastPositionBase && isFrc == lastPositionFrc &&
+                        moveTokens.size() >= lastPositionMoves.size() &&
+                        std::equal(lastPositionMoves.begin(), lastPositionMoves.end(), moveTokens.begin());
+
+  if (isContinuation) {
+    firstNew = lastPositionMoves.size();
+  } else {
+    if (base == "startpos") {
+      board.setToStartPos();
+    } else {
+      board.setToFen(base, isFrc);
+    }
+    positionHistory = Hist();
+  }
+
+  for (size_t i = firstNew; i < moveTokens.size(); i++) {
+    Move move = Move::fromNotation(board, moveTokens[i], isFrc);
+    if (move.getFlags() & Move::NULL_MOVE) {
+      continue;
+    }
 
-    MoveList moves = MoveList();
-    MoveGen movegen(&board, false, &moves);
-    for (auto &move : moves) {
-      if (move.getNotation((optionsMap["UCI_Chess960"].getValue() == "true")) == token) {
-        board.doMove(move);
-        if ((move.getPieceType() == PAWN) || (move.getFlags() & Move::CAPTURE) ){
-          positionHistory = Hist();
-        }
-        positionHistory.Add(board.getZKey().getValue());
-        break;
-      }
+    board.doMove(move);
+    if ((move.getPieceType() == PAWN) || (move.getFlags() & Move::CAPTURE) ){
+      positionHistory = Hist();
+    }
+    positionHistory.Add(board.getZKey().getValue());
+  }
+
+  lastPositionBase = base;
+  lastPositionFrc = isFrc;
+  lastPositionMoves = moveTokens;
+}
+
+void waitForSearch() {
+  if (searchThread.joinable()){
+    searchThread.join();
+  }
+
+  // Helpers can still run if main thread did not search (book move)
+  stopSignal = true;
+  for (int i = 1; i < MAX_THREADS; i++){
+    if (cThread[i].joinable()){
+      cThread[i].join();
     }
   }
 }
 
 void pickBestMove() {
   if (optionsMap["OwnBook"].getValue() == "true" && book.inBook(board)) {
+    // helpers were started for nothing
+    stopSignal = true;
     std::cout << "bestmove " << book.getMove(board).getNotation(board.getFrcMode()) << std::endl;
   } else {
     search->iterDeep();
@@ -169,6 +243,7 @@ void go(std::istringstream &is) {
   while (is >> token) {
     if (token == "depth") is >> limits.depth;
     else if (token == "infinite") limits.infinite = true;
+    else if (token == "ponder") limits.ponder = true;
     else if (token == "movetime") is >> limits.moveTime;
     else if (token == "nodes") is >> limits.nodes;
     else if (token == "wtime") is >> limits.time[WHITE];
@@ -176,31 +251,54 @@ void go(std::istringstream &is) {
     else if (token == "winc") is >> limits.increment[WHITE];
     else if (token == "binc") is >> limits.increment[BLACK];
     else if (token == "movestogo") is >> limits.movesToGo;
+    else if (token == "searchmoves") {
+      // read moves until the first token that is not a move
+      std::streampos pos = is.tellg();
+      while (is >> token) {
+        Move move = Move::fromNotation(board, token, board.getFrcMode());
+        if (move.getFlags() & Move::NULL_MOVE) {
+          is.clear();
+          is.seekg(pos);
+          break;
+        }
+        limits.searchMoves.push_back(move.getMoveINT());
+        pos = is.tellg();
+      }
+    }
   }
 
+  limits.multiPV = atoi(optionsMap["MultiPV"].getValue().c_str());
+  limits.moveOverhead = atoi(optionsMap["Move Overhead"].getValue().c_str());
+  limits.syzygyProbeLimit = atoi(optionsMap["SyzygyProbeLimit"].getValue().c_str());
+
+  // Make sure previous search is completely finished
+  // before Search objects are reused for the new one
+  waitForSearch();
+  stopSignal = false;
+
 // if we have > 1 threads, run some additional threads
   if (myTHREADSCOUNT > 1){
     for (int i = 1; i < myTHREADSCOUNT; i++){
-      // copy board stuff
-      Board b = board;
-      Limits l = limits;
-      Hist h = positionHistory;
-
-      // clear killers for every ordering
-      cOrdering[i]->clearKillers();
-      // create search and assign to the thread
-      cSearch[i] = new Search(b, l, h, cOrdering[i], false);
+      // Searches are kept between "go" commands,
+      // so only new part of the game is applied to them
+      if (cSearch[i] == nullptr){
+        cSearch[i] = new Search(board, limits, positionHistory, cOrdering[i], false, i);
+        cSearch[i]->setStopSignal(&stopSignal);
+      }else{
+        cSearch[i]->setPosition(board, limits, positionHistory);
+      }
       cThread[i] = std::thread(&Search::iterDeep, cSearch[i]);
     }
   }
 
-  myOrdering->clearKillers();
-  search = std::make_shared<Search>(board, limits, positionHistory, myOrdering);
-
-  std::thread searchThread(&pickBestMove);
-  searchThread.detach();
-
+  if (!search){
+    search = std::make_shared<Search>(board, limits, positionHistory, myOrdering);
+    search->setStopSignal(&stopSignal);
+  }else{
+    search->setPosition(board, limits, positionHistory);
+  }
 
+  searchThread = std::thread(&pickBestMove);
 }
 
 
@@ -233,10 +331,15 @@ void setOption(std::istringstream &is) {
   std::string token;
   std::string optionName;
 
-  is >> token >> optionName; // Advance past "name"
+  is >> token; // Advance past "name"
+
+  // Option names may contain spaces ("Move Overhead")
+  while (is >> token && token != "value") {
+    optionName += (optionName.empty() ? "" : " ") + token;
+  }
 
   if (optionsMap.find(optionName) != optionsMap.end()) {
-    is >> token >> token; // Advance past "value"
+    is >> token;
     optionsMap[optionName].setValue(token);
   } else {
     std::cout << "Invalid option" << std::endl;
@@ -265,11 +368,12 @@ void loop() {
       std::cout << "readyok" << std::endl;
     } else if (token == "stop") {
       if (search) search->stop();
+    } else if (token == "ponderhit") {
+      if (search) search->ponderHit();
     } else if (token == "go") {
       go(is);
     } else if (token == "quit") {
-      if (search) search->stop();
-      return;
+      break;
     } else if (token == "position") {
       setPosition(is);
     } else if (token == "setoption") {
@@ -286,10 +390,15 @@ void loop() {
         std::cout << move.getNotation(board.getFrcMode()) << " ";
       }
       std::cout << std::endl;
+    } else if (token == "stats") {
+      std::cout << Stats::report() << std::flush;
     } else {
       std::cout << "what?" << std::endl;
     }
   }
+
+  if (search) search->stop();
+  waitForSearch();
 }
 }
 
@@ -18,6 +18,7 @@
 #include "zkey.h"
 #include "board.h"
 #include "bitutils.h"
+#include "book.h"
 #include <random>
 #include <climits>
 #include <iostream>
@@ -62,6 +63,27 @@ void ZKey::init() {
     CASTLE_RIGHTS_KEYS[square] = dist(mt);
   }
 
+  // Keys of the standard chess position are PolyGlot ones,
+  // so opening book can use the board key directly
+  WHITE_TO_MOVE_KEY = Book::RANDOM_TURN;
+
+  for (int file = 0; file < 8; file++) {
+    EN_PASSANT_KEYS[file] = Book::RANDOM_ENPASSANT[file];
+  }
+
+  const int POLYGLOT_PIECE[6] = {0, 3, 1, 2, 4, 5};
+  for (int pieceType = 0; pieceType < 6; pieceType++) {
+    for (int square = 0; square < 64; square++) {
+      PIECE_KEYS[WHITE][pieceType][square] = Book::RANDOM_PIECE[64 * (2 * POLYGLOT_PIECE[pieceType] + 1) + square];
+      PIECE_KEYS[BLACK][pieceType][square] = Book::RANDOM_PIECE[64 * (2 * POLYGLOT_PIECE[pieceType]) + square];
+    }
+  }
+
+  CASTLE_RIGHTS_KEYS[h1] = Book::RANDOM_CASTLE[0];
+  CASTLE_RIGHTS_KEYS[a1] = Book::RANDOM_CASTLE[1];
+  CASTLE_RIGHTS_KEYS[h8] = Book::RANDOM_CASTLE[2];
+  CASTLE_RIGHTS_KEYS[a8] = Book::RANDOM_CASTLE[3];
+
 }
 
 ZKey::ZKey() {
@@ -0,0 +1,622 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Generator of the KPKP, KRKP and KBPK bitbases.
+//
+// Build and run: make bbgen [BBGEN_DIR=<output directory>]
+// Usage: Equisetum_bbgen <output directory> [threads]
+//
+// Bitbases are solved by exact retrograde analysis. Captures and promotions
+// lead to smaller endgames (KPK, KQKP, KRKQ, KBNK, ...), which are solved
+// first the same way, so every position is classified exactly as won for
+// the strong side or not (50-move rule is ignored). Generic KPK result is
+// checked against the embedded KPK bitbase. Files are written in the format
+// loaded by the engine from the BitbasePath directory.
+
+#include "attacks.h"
+#include "rays.h"
+#include "psquaretable.h"
+#include "zkey.h"
+#include "eval.h"
+#include "endgame.h"
+#include "orderinginfo.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+OrderingInfo * myOrdering;
+
+namespace {
+
+enum Result : uint8_t {
+    UNKNOWN = 0,
+    WIN     = 1,    // white wins
+    NOT_WIN = 2
+};
+
+// Pieces besides the kings, at most 2 of them
+const int MAX_MEN = 2;
+const int MAX_MOVES = 128;
+
+const char PIECE_CHARS[] = "PRNBQK";
+
+// Order of pieces in the endgame name: KQRKP, KBPK, ...
+int manOrder(Color color, PieceType type){
+    static const int TYPE_ORDER[] = {4, 1, 3, 2, 0};
+    return color * 5 + TYPE_ORDER[type];
+}
+
+struct Position {
+    Color     stm;
+    int       king[2];
+    int       count;
+    Color     color[MAX_MEN];
+    PieceType type[MAX_MEN];
+    int       sq[MAX_MEN];
+};
+
+struct Move {
+    Position child;
+    bool     exit;      // material changed, child is in another table
+    int      epSquare;  // square passed by a double push, -1 otherwise
+};
+
+struct Table {
+    std::string          name;
+    int                  kingCount;   // 32 with pawns (white king on files a-d), 10 without
+    unsigned int         size;
+    std::vector<uint8_t> win;         // 1 if white wins, empty if white has nothing to win with
+};
+
+// Tables by material code, see materialCode()
+const int CODE_BASE = 11;
+Table * tables[CODE_BASE * CODE_BASE];
+
+// White king squares of pawnless tables: a1-d1-d4 triangle
+int triangleIndex[64];
+int triangleSquare[10];
+
+// Men are kept sorted, so every material has one code
+void sortMen(Position &pos){
+    if (pos.count == 2 && manOrder(pos.color[0], pos.type[0]) > manOrder(pos.color[1], pos.type[1])){
+        std::swap(pos.color[0], pos.color[1]);
+        std::swap(pos.type[0], pos.type[1]);
+        std::swap(pos.sq[0], pos.sq[1]);
+    }
+}
+
+int materialCode(const Position &pos){
+    int code = 0;
+    for (int i = 0; i < pos.count; i++){
+        code = code * CODE_BASE + manOrder(pos.color[i], pos.type[i]) + 1;
+    }
+    return code;
+}
+
+std::string materialName(const Position &pos){
+    std::string name = "K";
+    for (Color color : {WHITE, BLACK}){
+        for (int i = 0; i < pos.count; i++){
+            if (pos.color[i] == color) name += PIECE_CHARS[pos.type[i]];
+        }
+        if (color == WHITE) name += "K";
+    }
+    return name;
+}
+
+bool hasPawns(const Position &pos){
+    for (int i = 0; i < pos.count; i++){
+        if (pos.type[i] == PAWN) return true;
+    }
+    return false;
+}
+
+unsigned int tableSize(int kingCount, int count){
+    unsigned int size = 2 * kingCount * 64;
+    for (int i = 0; i < count; i++) size *= 64;
+    return size;
+}
+
+unsigned int tableIndex(const Table &table, const Position &pos){
+    int squares[2 + MAX_MEN] = {pos.king[WHITE], pos.king[BLACK]};
+    int n = 2 + pos.count;
+    for (int i = 0; i < pos.count; i++) squares[i + 2] = pos.sq[i];
+
+    int wk;
+    if (table.kingCount == 32){
+        int mirror = _col(squares[0]) >= 4 ? 7 : 0;
+        for (int i = 0; i < n; i++) squares[i] ^= mirror;
+        wk = _row(squares[0]) * 4 + _col(squares[0]);
+    }else{
+        int mirror = (_col(squares[0]) >= 4 ? 7 : 0) ^ (_row(squares[0]) >= 4 ? 56 : 0);
+        for (int i = 0; i < n; i++) squares[i] ^= mirror;
+        if (_row(squares[0]) > _col(squares[0])){
+            for (int i = 0; i < n; i++) squares[i] = ((squares[i] & 7) << 3) | (squares[i] >> 3);
+        }
+        wk = triangleIndex[squares[0]];
+    }
+
+    unsigned int index = 0;
+    for (int i = n - 1; i >= 1; i--) index = index * 64 + squares[i];
+    return (index * table.kingCount + wk) * 2 + pos.stm;
+}
+
+void decodeIndex(const Table &table, unsigned int index, Position &pos){
+    pos.stm = (Color) (index & 1);
+    index >>= 1;
+
+    int wk = index % table.kingCount;
+    index /= table.kingCount;
+    pos.king[WHITE] = table.kingCount == 32 ? (wk / 4) * 8 + wk % 4 : triangleSquare[wk];
+    pos.king[BLACK] = index % 64;
+    index /= 64;
+    for (int i = 0; i < pos.count; i++){
+        pos.sq[i] = index % 64;
+        index /= 64;
+    }
+}
+
+U64 occupancy(const Position &pos){
+    U64 occ = _sqBB(pos.king[WHITE]) | _sqBB(pos.king[BLACK]);
+    for (int i = 0; i < pos.count; i++) occ |= _sqBB(pos.sq[i]);
+    return occ;
+}
+
+U64 attacks(PieceType type, int sq, Color color, U64 occ){
+    switch (type){
+        case PAWN:   return Attacks::getNonSlidingAttacks(PAWN, sq, color);
+        case KNIGHT:
+        case KING:   return Attacks::getNonSlidingAttacks(type, sq);
+        default:     return Attacks::getSlidingAttacks(type, sq, occ);
+    }
+}
+
+bool isAttacked(const Position &pos, int sq, Color by){
+    if (Attacks::getNonSlidingAttacks(KING, pos.king[by]) & _sqBB(sq)) return true;
+
+    U64 occ = occupancy(pos);
+    for (int i = 0; i < pos.count; i++){
+        if (pos.color[i] == by && (attacks(pos.type[i], pos.sq[i], by, occ) & _sqBB(sq))) return true;
+    }
+    return false;
+}
+
+bool isValid(const Position &pos){
+    U64 occ = _sqBB(pos.king[WHITE]);
+    if (occ & _sqBB(pos.king[BLACK])) return false;
+    occ |= _sqBB(pos.king[BLACK]);
+
+    for (int i = 0; i < pos.count; i++){
+        if (occ & _sqBB(pos.sq[i])) return false;
+        if (pos.type[i] == PAWN && (_row(pos.sq[i]) == 0 || _row(pos.sq[i]) == 7)) return false;
+        occ |= _sqBB(pos.sq[i]);
+    }
+
+    // side not to move can not be in check (kings can not touch)
+    return !isAttacked(pos, pos.king[getOppositeColor(pos.stm)], pos.stm);
+}
+
+bool inCheck(const Position &pos){
+    return isAttacked(pos, pos.king[pos.stm], getOppositeColor(pos.stm));
+}
+
+void removeMan(Position &pos, int i){
+    for (int j = i; j < pos.count - 1; j++){
+        pos.color[j] = pos.color[j + 1];
+        pos.type[j] = pos.type[j + 1];
+        pos.sq[j] = pos.sq[j + 1];
+    }
+    pos.count--;
+}
+
+// Adds the move of the piece (MAX_MEN is the king) if it is legal
+int addMove(const Position &pos, int piece, int to, int epSquare, Move * moves){
+    Color us = pos.stm;
+    Position child = pos;
+    bool exit = false;
+
+    for (int i = 0; i < child.count; i++){
+        if (child.sq[i] == to){
+            removeMan(child, i);
+            if (piece != MAX_MEN && i < piece) piece--;
+            exit = true;
+            break;
+        }
+    }
+
+    if (piece == MAX_MEN){
+        child.king[us] = to;
+    }else{
+        child.sq[piece] = to;
+    }
+    child.stm = getOppositeColor(us);
+
+    if (isAttacked(child, child.king[us], child.stm)) return 0;
+
+    // Promotions, all of them: underpromotion may avoid stalemate
+    if (piece != MAX_MEN && child.type[piece] == PAWN && _relrank(to, us) == 7){
+        int count = 0;
+        for (PieceType type : {QUEEN, ROOK, BISHOP, KNIGHT}){
+            moves[count].child = child;
+            moves[count].child.type[piece] = type;
+            moves[count].exit = true;
+            moves[count].epSquare = -1;
+            sortMen(moves[count].child);
+            count++;
+        }
+        return count;
+    }
+
+    if (exit) sortMen(child);
+    moves[0].child = child;
+    moves[0].exit = exit;
+    moves[0].epSquare = epSquare;
+    return 1;
+}
+
+// Legal moves of the side to move, en passant captures are not included
+int generate(const Position &pos, Move * moves){
+    Color us = pos.stm;
+    Color them = getOppositeColor(us);
+    U64 occ = occupancy(pos);
+    U64 own = _sqBB(pos.king[us]);
+    for (int i = 0; i < pos.count; i++){
+        if (pos.color[i] == us) own |= _sqBB(pos.sq[i]);
+    }
+    U64 enemies = occ & ~own & ~_sqBB(pos.king[them]);
+    int count = 0;
+
+    U64 targets = Attacks::getNonSlidingAttacks(KING, pos.king[us]) & ~own;
+    while (targets) count += addMove(pos, MAX_MEN, _popLsb(targets), -1, moves + count);
+
+    for (int i = 0; i < pos.count; i++){
+        if (pos.color[i] != us) continue;
+
+        if (pos.type[i] == PAWN){
+            int up = us == WHITE ? 8 : -8;
+            int from = pos.sq[i];
+            targets = attacks(PAWN, from, us, occ) & enemies;
+            while (targets) count += addMove(pos, i, _popLsb(targets), -1, moves + count);
+
+            if (!(occ & _sqBB(from + up))){
+                count += addMove(pos, i, from + up, -1, moves + count);
+                if (_relrank(from, us) == 1 && !(occ & _sqBB(from + 2 * up))){
+                    count += addMove(pos, i, from + 2 * up, from + up, moves + count);
+                }
+            }
+        }else{
+            targets = attacks(pos.type[i], pos.sq[i], us, occ) & ~own & ~_sqBB(pos.king[them]);
+            while (targets) count += addMove(pos, i, _popLsb(targets), -1, moves + count);
+        }
+    }
+
+    return count;
+}
+
+// En passant captures of the side to move after the double push over epSquare
+int generateEp(const Position &pos, int epSquare, Move * moves){
+    Color us = pos.stm;
+    int count = 0;
+
+    for (int i = 0; i < pos.count; i++){
+        if (pos.color[i] != us || pos.type[i] != PAWN) continue;
+        if (!(Attacks::getNonSlidingAttacks(PAWN, pos.sq[i], us) & _sqBB(epSquare))) continue;
+
+        Position child = pos;
+        int victim = epSquare + (us == WHITE ? -8 : 8);
+        child.sq[i] = epSquare;
+        for (int j = 0; j < child.count; j++){
+            if (child.sq[j] == victim){
+                removeMan(child, j);
+                break;
+            }
+        }
+        child.stm = getOppositeColor(us);
+        if (isAttacked(child, child.king[us], child.stm)) continue;
+
+        sortMen(child);
+        moves[count].child = child;
+        moves[count].exit = true;
+        moves[count].epSquare = -1;
+        count++;
+    }
+
+    return count;
+}
+
+// Result of the solved table
+Result lookup(const Position &pos){
+    const Table * table = tables[materialCode(pos)];
+    if (table->win.empty()) return NOT_WIN;
+    return table->win[tableIndex(*table, pos)] ? WIN : NOT_WIN;
+}
+
+// Table being solved
+struct Solver {
+    const Table * table;
+    std::unique_ptr<std::atomic<uint8_t>[]> state;
+
+    Result get(const Position &pos) const {
+        return (Result) state[tableIndex(*table, pos)].load(std::memory_order_relaxed);
+    }
+
+    // Result of the move for the white, with en passant replies to a double push
+    Result moveResult(const Move &move) const {
+        Result result = move.exit ? lookup(move.child) : get(move.child);
+        if (move.epSquare < 0) return result;
+
+        Move replies[MAX_MEN];
+        int count = generateEp(move.child, move.epSquare, replies);
+        if (count == 0) return result;
+
+        bool unknown = false;
+        if (move.child.stm == WHITE){
+            // white picks the best reply
+            if (result == WIN) return WIN;
+            unknown = result == UNKNOWN;
+            for (int i = 0; i < count; i++){
+                if (lookup(replies[i].child) == WIN) return WIN;
+            }
+            return unknown ? UNKNOWN : NOT_WIN;
+        }
+
+        // black: without other moves table result is mate or stalemate,
+        // en passant captures are the only replies then
+        Move moves[MAX_MOVES];
+        if (generate(move.child, moves) > 0){
+            if (result == NOT_WIN) return NOT_WIN;
+            unknown = result == UNKNOWN;
+        }
+        for (int i = 0; i < count; i++){
+            if (lookup(replies[i].child) == NOT_WIN) return NOT_WIN;
+        }
+        return unknown ? UNKNOWN : WIN;
+    }
+
+    Result classify(const Position &pos) const {
+        Move moves[MAX_MOVES];
+        int count = generate(pos, moves);
+
+        if (count == 0) return pos.stm == BLACK && inCheck(pos) ? WIN : NOT_WIN;
+
+        // white needs one winning move, black needs one move that does not lose
+        Result good = pos.stm == WHITE ? WIN : NOT_WIN;
+        bool unknown = false;
+        for (int i = 0; i < count; i++){
+            Result result = moveResult(moves[i]);
+            if (result == good) return good;
+            unknown |= result == UNKNOWN;
+        }
+        return unknown ? UNKNOWN : (pos.stm == WHITE ? NOT_WIN : WIN);
+    }
+};
+
+const unsigned int BLOCK_SIZE = 1 << 14;
+
+template <typename F>
+void parallelFor(unsigned int size, int threadsCount, F body){
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsCount; t++){
+        threads.emplace_back([=]{
+            for (unsigned int start = t * BLOCK_SIZE; start < size; start += threadsCount * BLOCK_SIZE){
+                body(start, std::min(size, start + BLOCK_SIZE));
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+}
+
+void solve(Table &table, const Position &material, int threadsCount){
+    Solver solver;
+    solver.table = &table;
+    solver.state.reset(new std::atomic<uint8_t>[table.size]);
+
+    parallelFor(table.size, threadsCount, [&](unsigned int start, unsigned int end){
+        Position pos = material;
+        for (unsigned int index = start; index < end; index++){
+            decodeIndex(table, index, pos);
+            solver.state[index].store(isValid(pos) ? UNKNOWN : NOT_WIN, std::memory_order_relaxed);
+        }
+    });
+
+    // Positions are classified again until nothing changes (as in KPK generator),
+    // positions left unknown are not won: white can not force a win there
+    int passes = 0;
+    std::atomic<bool> changed;
+    do {
+        changed = false;
+        passes++;
+        parallelFor(table.size, threadsCount, [&](unsigned int start, unsigned int end){
+            Position pos = material;
+            bool blockChanged = false;
+            for (unsigned int index = start; index < end; index++){
+                if (solver.state[index].load(std::memory_order_relaxed) != UNKNOWN) continue;
+
+                decodeIndex(table, index, pos);
+                Result result = solver.classify(pos);
+                if (result != UNKNOWN){
+                    solver.state[index].store(result, std::memory_order_relaxed);
+                    blockChanged = true;
+                }
+            }
+            if (blockChanged) changed = true;
+        });
+    } while (changed);
+
+    table.win.resize(table.size);
+    U64 wins = 0;
+    for (unsigned int index = 0; index < table.size; index++){
+        table.win[index] = solver.state[index].load(std::memory_order_relaxed) == WIN;
+        wins += table.win[index];
+    }
+
+    printf("%-6s %10u positions %10llu won, %d passes\n", table.name.c_str(), table.size, (unsigned long long) wins, passes);
+    fflush(stdout);
+}
+
+// Returns solved table of the material, endgames it converts to are solved first
+Table * getTable(const Position &material, int threadsCount){
+    int code = materialCode(material);
+    if (tables[code] != nullptr) return tables[code];
+
+    for (int i = 0; i < material.count; i++){
+        Position child = material;
+        removeMan(child, i);
+        getTable(child, threadsCount);
+
+        if (material.type[i] == PAWN){
+            for (PieceType type : {QUEEN, ROOK, BISHOP, KNIGHT}){
+                child = material;
+                child.type[i] = type;
+                sortMen(child);
+                getTable(child, threadsCount);
+            }
+        }
+    }
+
+    Table * table = new Table();
+    table->name = materialName(material);
+    table->kingCount = hasPawns(material) ? 32 : 10;
+    table->size = tableSize(table->kingCount, material.count);
+    tables[code] = table;
+
+    bool whiteMen = false;
+    for (int i = 0; i < material.count; i++) whiteMen |= material.color[i] == WHITE;
+    if (whiteMen) solve(*table, material, threadsCount);
+
+    return table;
+}
+
+Position makeMaterial(int count, const Color * color, const PieceType * type){
+    Position pos = {};
+    pos.count = count;
+    for (int i = 0; i < count; i++){
+        pos.color[i] = color[i];
+        pos.type[i] = type[i];
+    }
+    sortMen(pos);
+    return pos;
+}
+
+// Generic KPK table must be the same as the embedded one
+bool checkKpk(int threadsCount){
+    Color color = WHITE;
+    PieceType type = PAWN;
+    Position pos = makeMaterial(1, &color, &type);
+    getTable(pos, threadsCount);
+
+    int mismatches = 0;
+    for (Color stm : {WHITE, BLACK}){
+        for (int wk = 0; wk < 64; wk++){
+            for (int bk = 0; bk < 64; bk++){
+                for (int pawn = a2; pawn <= h7; pawn++){
+                    if (_col(pawn) >= 4) continue;
+                    pos.stm = stm;
+                    pos.king[WHITE] = wk;
+                    pos.king[BLACK] = bk;
+                    pos.sq[0] = pawn;
+                    if (!isValid(pos)) continue;
+
+                    bool win = lookup(pos) == WIN;
+                    mismatches += win != Bitbase::kpk_is_winning(stm, bk, wk, pawn);
+                }
+            }
+        }
+    }
+
+    if (mismatches > 0) fprintf(stderr, "KPK: %d positions differ from the embedded bitbase\n", mismatches);
+    return mismatches == 0;
+}
+
+// Converts the table to the engine format (see Bitbase::bitbase_index())
+std::vector<uint8_t> exportBitbase(Bitbase::egBitbase bb, int threadsCount){
+    const Bitbase::egBitbaseSpec &spec = Bitbase::EG_BITBASE_SPECS[bb];
+    Position pos = makeMaterial(2, spec.color, spec.type);
+    getTable(pos, threadsCount);
+
+    std::vector<uint8_t> data(Bitbase::EG_BITBASE_SIZE / 8);
+    for (unsigned int index = 0; index < Bitbase::EG_BITBASE_SIZE; index++){
+        int leading = (index >> 13) % 24;
+        int squares[4] = {(int) (index >> 1) & 63, (int) (index >> 7) & 63,
+                          (leading / 4 + 1) * 8 + leading % 4, (int) (index >> 13) / 24};
+
+        pos.stm = (Color) (index & 1);
+        pos.king[WHITE] = squares[0];
+        pos.king[BLACK] = squares[1];
+        for (int i = 0; i < 2; i++){
+            pos.color[i] = spec.color[i];
+            pos.type[i] = spec.type[i];
+            pos.sq[i] = squares[i + 2];
+        }
+        sortMen(pos);
+
+        if (isValid(pos) && lookup(pos) == WIN) data[index / 8] |= 1 << (index % 8);
+    }
+
+    return data;
+}
+
+}
+
+int main(int argCount, char* argValue[]) {
+  if (argCount < 2) {
+    fprintf(stderr, "Usage: %s <output directory> [threads]\n", argValue[0]);
+    return 1;
+  }
+
+  std::string path = argValue[1];
+  int threadsCount = argCount > 2 ? std::max(1, atoi(argValue[2])) : 1;
+
+  Rays::init();
+  PSquareTable::init();
+  ZKey::init();
+  Attacks::init();
+  Eval::init();
+
+  for (int sq = 0; sq < 64; sq++) triangleIndex[sq] = -1;
+  int count = 0;
+  for (int sq = 0; sq < 64; sq++) {
+    if (_col(sq) <= 3 && _row(sq) <= _col(sq)) {
+      triangleIndex[sq] = count;
+      triangleSquare[count++] = sq;
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  if (!checkKpk(threadsCount)) return 1;
+
+  for (int bb = 0; bb < Bitbase::BB_NUMBER; bb++) {
+    std::vector<uint8_t> data = exportBitbase((Bitbase::egBitbase) bb, threadsCount);
+    if (!Bitbase::save_bitbase((Bitbase::egBitbase) bb, path, data)) {
+      fprintf(stderr, "Can not write %s bitbase to %s\n", Bitbase::EG_BITBASE_SPECS[bb].name, path.c_str());
+      return 1;
+    }
+  }
+
+  int seconds = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count();
+  printf("Bitbases are written to %s in %d s\n", path.c_str(), seconds);
+
+  return 0;
+}
@@ -0,0 +1,77 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Generator of the embedded KPK bitbase.
+//
+// Build and run: make kpkgen
+// Usage: Equisetum_kpkgen <output header>
+//
+// Runs the retrograde analysis of Bitbase::generate_kpk() and writes
+// the result as a C array, which is compiled into the engine instead of
+// building the bitbase on every startup.
+
+#include "attacks.h"
+#include "rays.h"
+#include "psquaretable.h"
+#include "zkey.h"
+#include "eval.h"
+#include "endgame.h"
+#include "orderinginfo.h"
+#include <cstdio>
+
+OrderingInfo * myOrdering;
+
+static uint8_t bitbase[KPK_SIZE / 8];
+
+int main(int argCount, char* argValue[]) {
+  if (argCount < 2) {
+    fprintf(stderr, "Usage: %s <output header>\n", argValue[0]);
+    return 1;
+  }
+
+  Rays::init();
+  PSquareTable::init();
+  ZKey::init();
+  Attacks::init();
+  Eval::init();
+
+  Bitbase::generate_kpk(bitbase);
+
+  FILE * out = fopen(argValue[1], "w");
+  if (out == NULL) {
+    fprintf(stderr, "Can not open %s\n", argValue[1]);
+    return 1;
+  }
+
+  fprintf(out, "// KPK bitbase, generated by \"make kpkgen\" (tools/kpkgen.cc), do not edit.\n");
+  fprintf(out, "// Bit is set for positions won by the side with a pawn,\n");
+  fprintf(out, "// see Bitbase::kpk_get_index() for the indexing.\n");
+  fprintf(out, "#ifndef KPKBITBASE_H\n#define KPKBITBASE_H\n\n");
+  fprintf(out, "#include \"endgame.h\"\n\n");
+  fprintf(out, "const uint8_t KPK_Bitbase[KPK_SIZE / 8] = {\n");
+
+  for (int i = 0; i < KPK_SIZE / 8; i++) {
+    fprintf(out, "%s0x%02x%s", i % 16 == 0 ? "  " : "", bitbase[i],
+            i == KPK_SIZE / 8 - 1 ? "\n" : i % 16 == 15 ? ",\n" : ",");
+  }
+
+  fprintf(out, "};\n\n#endif\n");
+  fclose(out);
+
+  return 0;
+}
@@ -0,0 +1,345 @@
+/*
+    Equisetum - UCI compatable chess engine
+        Copyright (C) 2017 - 2019  Rhys Rustad-Elliott
+                      2020 - 2023  Litov Alexander
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Microbenchmarks of the hot engine kernels.
+//
+// Build: make microbench
+// Usage: Equisetum_mbench [filter] [samples]
+//
+// Every kernel is timed in samples, each sample runs the kernel over the
+// whole prepared input set. Per-operation time (and TSC cycles on x86)
+// is reported as min / median / p90 / p99 over samples.
+// Sliding attacks use PEXT or magic indexing depending on the build,
+// build with "make microbench NO_PEXT=1" (after make clean) to get magics.
+
+#include "board.h"
+#include "movegen.h"
+#include "attacks.h"
+#include "rays.h"
+#include "psquaretable.h"
+#include "zkey.h"
+#include "eval.h"
+#include "nnue.h"
+#include "finnyentry.h"
+#include "transptable.h"
+#include "orderinginfo.h"
+#include "bench.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+#include <vector>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define MB_HAS_TSC
+#endif
+
+extern HASH * myHASH;
+OrderingInfo * myOrdering;
+
+namespace {
+
+// keeps results alive, so compiler can not drop the measured code
+volatile U64 sink;
+
+std::string filter;
+int samplesCount = 50;
+
+inline U64 readCycles(){
+#ifdef MB_HAS_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+double percentile(std::vector<double> v, int p){
+    std::sort(v.begin(), v.end());
+    size_t i = std::min(v.size() - 1, v.size() * p / 100);
+    return v[i];
+}
+
+// Runs kernel samplesCount times (after one warm-up run),
+// kernel returns number of operations it performed
+template <typename Kernel>
+void measure(const std::string &name, Kernel kernel){
+    if (!filter.empty() && name.find(filter) == std::string::npos) return;
+
+    sink = sink + kernel();
+
+    std::vector<double> ns, cycles;
+    for (int i = 0; i < samplesCount; i++){
+        auto start = std::chrono::steady_clock::now();
+        U64 c0 = readCycles();
+        U64 ops = kernel();
+        U64 c1 = readCycles();
+        auto end = std::chrono::steady_clock::now();
+
+        ops = std::max(ops, (U64) 1);
+        ns.push_back(std::chrono::duration<double, std::nano>(end - start).count() / ops);
+        cycles.push_back((double) (c1 - c0) / ops);
+    }
+
+    printf("%-28s %9.1f %9.1f %9.1f %9.1f %10.1f\n", name.c_str(),
+           percentile(ns, 0), percentile(ns, 50), percentile(ns, 90), percentile(ns, 99), percentile(cycles, 50));
+    fflush(stdout);
+}
+
+U64 xorshift(U64 &s){
+    s ^= s << 13;
+    s ^= s >> 7;
+    s ^= s << 17;
+    return s;
+}
+
+// Shared inputs: bench positions and their moves
+struct Inputs {
+    std::vector<Board> boards;
+    std::vector<std::vector<Move>> moves;
+    std::vector<std::vector<Move>> captures;
+};
+
+void benchMoveGen(const Inputs &in){
+    MoveList list;
+    MoveGen gen(&list);
+
+    measure("movegen_all", [&](){
+        U64 ops = 0;
+        for (const Board &b : in.boards){
+            list.clear();
+            gen.setBoard(&b, false);
+            sink = sink + list.size();
+            ops++;
+        }
+        return ops;
+    });
+
+    measure("movegen_captures", [&](){
+        U64 ops = 0;
+        for (const Board &b : in.boards){
+            list.clear();
+            gen.setBoard(&b, true);
+            sink = sink + list.size();
+            ops++;
+        }
+        return ops;
+    });
+}
+
+void benchDoMove(const Inputs &in){
+    measure("board_domove", [&](){
+        U64 ops = 0;
+        for (size_t i = 0; i < in.boards.size(); i++){
+            for (const Move &m : in.moves[i]){
+                Board b = in.boards[i];
+                sink = sink + b.doMove(m);
+                ops++;
+            }
+        }
+        return ops;
+    });
+}
+
+void benchSEE(const Inputs &in){
+    measure("see_greater_or_equal", [&](){
+        U64 ops = 0;
+        for (size_t i = 0; i < in.boards.size(); i++){
+            for (const Move &m : in.captures[i]){
+                sink = sink + in.boards[i].SEE_GreaterOrEqual(m, 0);
+                ops++;
+            }
+        }
+        return ops;
+    });
+}
+
+FinnyEntry     finnyTable[2][2][NNUE_BUCKETS];
+NNueEvaluation nnCache[2][NNUE_BUCKETS];
+NNueEvaluation nnStack[2][2];
+
+void benchNNue(const Inputs &in){
+    std::vector<NNueEvaluation> accs;
+    for (const Board &b : in.boards){
+        accs.push_back(NNueEvaluation(b));
+    }
+
+    measure("nnue_evaluate", [&](){
+        U64 ops = 0;
+        for (size_t i = 0; i < accs.size(); i++){
+            sink = sink + accs[i].evaluate(in.boards[i].getActivePlayer());
+            ops++;
+        }
+        return ops;
+    });
+
+    measure("nnue_full_reset", [&](){
+        U64 ops = 0;
+        for (size_t i = 0; i < accs.size(); i++){
+            accs[i].fullReset(in.boards[i]);
+            ops++;
+        }
+        return ops;
+    });
+
+    // Children of every position with pending accumulator update,
+    // incremental and refresh variants point to different accumulator stacks
+    std::vector<Board> incMoved, refMoved;
+    for (size_t i = 0; i < in.boards.size(); i++){
+        Board inc = in.boards[i];
+        Board ref = in.boards[i];
+        inc.setNnuePtr(&nnStack[0][0]);
+        ref.setNnuePtr(&nnStack[1][0]);
+        for (const Move &m : in.moves[i]){
+            Board b = inc;
+            if (b.doMove(m)) incMoved.push_back(b);
+            b = ref;
+            if (b.doMove(m)) refMoved.push_back(b);
+        }
+    }
+
+    nnStack[0][0].fullReset(in.boards[0]);
+    measure("nnue_update_incremental", [&](){
+        U64 ops = 0;
+        for (const Board &m : incMoved){
+            Board b = m;
+            b.performUpdate(&finnyTable, &nnCache);
+            ops++;
+        }
+        return ops;
+    });
+
+    measure("nnue_update_refresh", [&](){
+        U64 ops = 0;
+        for (const Board &m : refMoved){
+            Board b = m;
+            b.refreshAccumulator(&finnyTable, &nnCache);
+            ops++;
+        }
+        return ops;
+    });
+}
+
+void benchHash(){
+    const int KEYS = 1 << 16;
+    std::vector<U64> keys(KEYS);
+    U64 seed = 0x9E3779B97F4A7C15ULL;
+    for (U64 &k : keys) k = xorshift(seed);
+
+    for (int mb : {8, 64, 256}){
+        HASH hash;
+        hash.HASH_Initalize_MB(mb);
+        std::string suffix = "_" + std::to_string(mb) + "mb";
+
+        measure("tt_store" + suffix, [&](){
+            for (int i = 0; i < KEYS; i++){
+                hash.HASH_Store(keys[i], i, EXACT, false, i & 1023, i & 63, 0);
+            }
+            return (U64) KEYS;
+        });
+
+        measure("tt_get" + suffix, [&](){
+            for (int i = 0; i < KEYS; i++){
+                sink = sink + hash.HASH_Get(keys[i]).move;
+            }
+            return (U64) KEYS;
+        });
+    }
+}
+
+void benchSliders(const Inputs &in){
+    // (square, occupancy) pairs of every piece square in bench positions
+    std::vector<std::pair<int, U64>> queries;
+    for (const Board &b : in.boards){
+        U64 occ = b.getOccupied();
+        U64 pieces = occ;
+        while (pieces){
+            queries.push_back(std::make_pair(_popLsb(pieces), occ));
+        }
+    }
+
+#ifdef _UPEXT_
+    std::string mode = "_pext";
+#else
+    std::string mode = "_magic";
+#endif
+
+    for (PieceType pt : {BISHOP, ROOK, QUEEN}){
+        std::string name = pt == BISHOP ? "bishop" : pt == ROOK ? "rook" : "queen";
+        measure("sliders_" + name + mode, [&](){
+            for (auto &q : queries){
+                sink = sink + Attacks::getSlidingAttacks(pt, q.first, q.second);
+            }
+            return (U64) queries.size();
+        });
+    }
+
+    // reference ray-walk implementation, used to build the tables
+    measure("sliders_rook_rays", [&](){
+        for (auto &q : queries){
+            sink = sink + Attacks::detail::_getRookAttacksSlow(q.first, q.second);
+        }
+        return (U64) queries.size();
+    });
+}
+
+}
+
+int main(int argCount, char* argValue[]) {
+  Rays::init();
+  PSquareTable::init();
+  ZKey::init();
+  Attacks::init();
+  Eval::init();
+  NNueEvaluation::init();
+
+  myHASH = new HASH();
+  myHASH->HASH_Initalize_MB(16);
+
+  myOrdering = new OrderingInfo();
+
+  if (argCount > 1) filter = argValue[1];
+  if (argCount > 2) samplesCount = std::max(1, atoi(argValue[2]));
+
+  Inputs in;
+  for (int i = 0; i < BENCH_POS_NUMBER; i++){
+    Board b = Board(BENCH_POSITION[i], false);
+    MoveList list;
+    MoveGen gen(&list);
+
+    list.clear();
+    gen.setBoard(&b, false);
+    in.moves.push_back(list);
+    list.clear();
+    gen.setBoard(&b, true);
+    in.captures.push_back(list);
+    in.boards.push_back(b);
+  }
+
+  printf("%-28s %9s %9s %9s %9s %10s\n", "kernel (per op)", "min ns", "p50 ns", "p90 ns", "p99 ns", "p50 cycles");
+
+  benchMoveGen(in);
+  benchDoMove(in);
+  benchSEE(in);
+  benchNNue(in);
+  benchHash();
+  benchSliders(in);
+
+  return 0;
+}